@@ -163,6 +163,22 @@ REBNATIVE(map_event)
 }
 
 
+// Length of the System Port's event queue (0 if it isn't set up).
+//
+static REBLEN Event_Queue_Len(void)
+{
+    REBVAL *sport = Get_System(SYS_PORTS, PORTS_SYSTEM);
+    if (not IS_PORT(sport))
+        return 0;
+
+    REBVAL *queue = CTX_VAR(VAL_CONTEXT(sport), STD_PORT_STATE);
+    if (not IS_BLOCK(queue))
+        return 0;
+
+    return VAL_LEN_HEAD(queue);
+}
+
+
 //
 //  Wait_For_Device_Events_Interruptible: C
 //
@@ -173,6 +189,7 @@ REBNATIVE(map_event)
 // Res specifies resolution. (No wait if less than this.)
 //
 // Returns:
+//     -2: Event queue is full, so devices weren't polled (no wait either)
 //     -1: Devices have changed state.
 //      0: past given millsecs
 //      1: wait in timer
@@ -188,6 +205,12 @@ int Wait_For_Device_Events_Interruptible(
 
     int64_t base = Delta_Time(0); // start timing
 
+    // If the event queue is full, don't poll the devices: let the awake
+    // handlers catch up first.
+    //
+    if (Event_Queue_Len() >= EVENTS_HIGH_WATER)
+        return -2;
+
     // !!! The request is created here due to a comment that said "setup for
     // timing" and said it was okay to stack allocate it because "QUERY
     // below does not store it".  Having eliminated stack-allocated REBREQ,
@@ -254,6 +277,7 @@ bool Wait_Ports_Throws(
     REBLEN time;
     REBLEN wt = 1;
     REBLEN res = (timeout >= 1000) ? 0 : 16;  // OS dependent?
+    REBLEN backlog = 0;  // queue length when devices were last held off
 
     // Waiting opens the doors to pressing Ctrl-C, which may get this code
     // to throw an error.  There needs to be a state to catch it.
@@ -286,6 +310,17 @@ bool Wait_Ports_Throws(
             return false; // not thrown
         }
 
+        // With the queue full, devices aren't polled until the awake above
+        // has taken some events out.  If it couldn't (a WAIT/ONLY whose
+        // ports aren't the ones the events are for) nothing else would, and
+        // this would spin without ever sleeping or polling.
+        //
+        if (backlog != 0) {
+            if (Event_Queue_Len() >= backlog)
+                fail ("Event queue is full of events WAIT isn't dispatching");
+            backlog = 0;
+        }
+
         // If activity, use low wait time, otherwise increase it:
         if (ret == 0) wt = 1;
         else {
@@ -310,7 +345,10 @@ bool Wait_Ports_Throws(
 
         //printf("%d %d %d\n", dt, time, timeout);
 
-        Wait_For_Device_Events_Interruptible(wt, res);
+        if (Wait_For_Device_Events_Interruptible(wt, res) == -2) {
+            backlog = Event_Queue_Len();
+            wt = 1;  // didn't sleep, so don't back off
+        }
     }
 
     //time = (REBLEN)Delta_Time(base);
@@ -430,26 +468,20 @@ REBNATIVE(wait)
 }
 
 
+// Calls port update for native actors, once per event.
+// Calls port awake function, with the event or a BLOCK! of `num_events`.
+// Output is whether the awake function said the port woke up.
 //
-//  export wake-up: native [
-//
-//  "Awake and update a port with event."
-//
-//      return: [logic!]
-//      port [port!]
-//      event [event!]
-//  ]
-//
-REBNATIVE(wake_up)
-//
-// Calls port update for native actors.
-// Calls port awake function.
-{
-    EVENT_INCLUDE_PARAMS_OF_WAKE_UP;
-
-    FAIL_IF_BAD_PORT(ARG(port));
+static bool Wake_Up_Throws(
+    REBVAL *out,
+    REBFRM *frame_,
+    REBVAL *port,
+    const REBVAL *arg,
+    REBLEN num_events
+){
+    FAIL_IF_BAD_PORT(port);
 
-    REBCTX *ctx = VAL_CONTEXT(ARG(port));
+    REBCTX *ctx = VAL_CONTEXT(port);
 
     REBVAL *actor = CTX_VAR(ctx, STD_PORT_ACTOR);
     if (Is_Native_Port_Actor(actor)) {
@@ -463,23 +495,203 @@ REBNATIVE(wake_up)
         //
         DECLARE_LOCAL (verb);
         Init_Word(verb, Canon(SYM_ON_WAKE_UP));
-        const REBVAL *r = Do_Port_Action(frame_, ARG(port), verb);
-        assert(IS_VOID(r));
-        UNUSED(r);
+
+        REBLEN n;
+        for (n = 0; n < num_events; ++n) {
+            const REBVAL *r = Do_Port_Action(frame_, port, verb);
+            assert(IS_VOID(r));
+            UNUSED(r);
+        }
     }
 
-    bool woke_up = true; // start by assuming success
+    // Count what the port has been sent, so busy ports can be found by
+    // looking at their EVENTS field.
+    //
+    REBVAL *count = CTX_VAR(ctx, STD_PORT_EVENTS);
+    if (IS_INTEGER(count))
+        VAL_INT64(count) += num_events;
+    else
+        Init_Integer(count, num_events);
 
     REBVAL *awake = CTX_VAR(ctx, STD_PORT_AWAKE);
     if (IS_ACTION(awake)) {
         const bool fully = true; // error if not all arguments consumed
 
-        if (RunQ_Throws(D_OUT, fully, rebU1(awake), ARG(event), rebEND))
+        if (RunQ_Throws(out, fully, rebU1(awake), arg, rebEND))
+            return true;
+
+        if (IS_LOGIC(out) and VAL_LOGIC(out))
+            return false;
+
+        Init_False(out);
+        return false;
+    }
+
+    Init_True(out); // no awake function, so it's up
+    return false;
+}
+
+
+//
+//  export wake-up: native [
+//
+//  "Awake and update a port with event."
+//
+//      return: [logic!]
+//      port [port!]
+//      event [event!]
+//  ]
+//
+REBNATIVE(wake_up)
+{
+    EVENT_INCLUDE_PARAMS_OF_WAKE_UP;
+
+    if (Wake_Up_Throws(D_OUT, frame_, ARG(port), ARG(event), 1))
+        fail (Error_No_Catch_For_Throw(D_OUT));
+
+    return D_OUT;
+}
+
+
+// The system port's awake used to handle at most 8 events per call, so
+// device polling would not be locked out.  Dispatching natively makes each
+// event cheaper, so more are handled per call.
+//
+#define MAX_EVENTS_PER_AWAKE 64
+
+
+//
+//  dispatch-events: native [
+//
+//  {Send queued events to the awake functions of their ports}
+//
+//      return: [blank! logic!]
+//          {BLANK! if no PORTS, else if any of them were woken up}
+//      sport [port!]
+//          "System port (State block holds events)"
+//      ports [block! blank!]
+//          "Port list (Copy of block passed to WAIT)"
+//      /only
+//          "Only dispatch events for the ports in the list"
+//  ]
+//
+REBNATIVE(dispatch_events)
+//
+// This is the AWAKE of the System Port, which was formerly written in Rebol.
+// It would make a frame for WAKE-UP for each event, and FIND the port in the
+// wait list and in the wake list.
+//
+// If a port's AWAKE takes a BLOCK! and not an EVENT!, it is given all the
+// events for it which are together in the queue (up to the limit per call)
+// in one call, instead of being called once for each.
+{
+    EVENT_INCLUDE_PARAMS_OF_DISPATCH_EVENTS;
+
+    REBCTX *sport = VAL_CONTEXT(ARG(sport));
+    REBVAL *waked = CTX_VAR(sport, STD_PORT_DATA);  // wake list
+    REBVAL *state = CTX_VAR(sport, STD_PORT_STATE);  // event queue
+    if (not IS_BLOCK(waked) or not IS_BLOCK(state))
+        fail (PAR(sport));
+
+    REBVAL *ports = ARG(ports);
+    if (REF(only) and not IS_BLOCK(ports))
+        return Init_Blank(D_OUT);  // short cut for a pause
+
+    DECLARE_LOCAL (port);
+    Init_Blank(port);
+    PUSH_GC_GUARD(port);
+
+    DECLARE_LOCAL (arg);
+    Init_Blank(arg);
+    PUSH_GC_GUARD(arg);
+
+    REBLEN n_event = 0;
+    REBLEN i = 0;  // events before this are for ports not being waited on
+    while (n_event < MAX_EVENTS_PER_AWAKE) {
+        REBARR *queue = VAL_ARRAY(state);  // refetch, awake may have WAITed
+        if (i >= ARR_LEN(queue))
+            break;
+
+        RELVAL *event = ARR_AT(queue, i);
+        if (
+            not Get_Event_Var(port, event, Canon(SYM_PORT))
+            or not IS_PORT(port)
+        ){
+            Move_Value(arg, KNOWN(event));
+            Remove_Series_Units(SER(queue), i, 1);
+            fail (Error_Bad_Value(arg));  // don't fail on it again
+        }
+
+        if (
+            REF(only)
+            and ARR_LEN(VAL_ARRAY(ports))
+                == Find_In_Array_Simple(VAL_ARRAY(ports), 0, port)
+        ){
+            ++i;
+            continue;
+        }
+
+        REBVAL *awake = CTX_VAR(VAL_CONTEXT(port), STD_PORT_AWAKE);
+        REBVAL *param = IS_ACTION(awake)
+            ? First_Unspecialized_Param(VAL_ACTION(awake))
+            : nullptr;
+
+        REBLEN n = 1;
+        if (
+            param
+            and TYPE_CHECK(param, REB_BLOCK)
+            and not TYPE_CHECK(param, REB_EVENT)
+        ){
+            for (; n_event + n < MAX_EVENTS_PER_AWAKE; ++n) {
+                if (i + n >= ARR_LEN(queue))
+                    break;
+                if (
+                    not Get_Event_Var(D_SPARE, ARR_AT(queue, i + n),
+                        Canon(SYM_PORT))
+                    or not IS_PORT(D_SPARE)
+                    or VAL_CONTEXT(D_SPARE) != VAL_CONTEXT(port)
+                ){
+                    break;
+                }
+            }
+            Init_Block(
+                arg,
+                Copy_Array_At_Max_Shallow(queue, i, SPECIFIED, n)
+            );
+        }
+        else
+            Move_Value(arg, KNOWN(event));
+
+        // Take the events out of the queue before dispatching them, in case
+        // the awake function calls WAIT (which would dispatch them again).
+        //
+        Remove_Series_Units(SER(queue), i, n);
+        n_event += n;
+
+        if (Wake_Up_Throws(D_OUT, frame_, port, arg, n))
             fail (Error_No_Catch_For_Throw(D_OUT));
 
-        if (not (IS_LOGIC(D_OUT) and VAL_LOGIC(D_OUT)))
-            woke_up = false;
+        if (VAL_LOGIC(D_OUT)) {
+            REBARR *list = VAL_ARRAY(waked);
+            if (ARR_LEN(list) == Find_In_Array_Simple(list, 0, port))
+                Append_Value(list, port);
+        }
+    }
+
+    DROP_GC_GUARD(arg);
+    DROP_GC_GUARD(port);
+
+    if (not IS_BLOCK(ports))
+        return Init_Blank(D_OUT);  // no wake ports (just a timer)
+
+    // Are any of the requested ports awake?
+    //
+    RELVAL *item = VAL_ARRAY_AT(ports);
+    for (; NOT_END(item); ++item) {
+        REBARR *list = VAL_ARRAY(waked);
+        if (ARR_LEN(list) != Find_In_Array_Simple(list, 0, item))
+            return Init_True(D_OUT);
     }
 
-    return Init_Logic(D_OUT, woke_up);
+    return Init_False(D_OUT);  // keep waiting
 }
@@ -53,9 +53,6 @@
 
 #include "reb-event.h"
 
-#define EVENTS_LIMIT 0xFFFF //64k
-#define EVENTS_CHUNK 128
-
 //
 //  Append_Event: C
 //
@@ -66,6 +63,10 @@
 // so do NOT extend the event queue here. If it does not have
 // space, return 0. (Should it overwrite or wrap???)
 //
+// R3-Alpha would panic if the queue went past EVENTS_LIMIT.  Now the caller
+// gets 0 and drops the event.  (The devices in this tree don't use this, but
+// INSERT into the System Port, which fails at the limit instead.)
+//
 REBVAL *Append_Event(void)
 {
     REBVAL *port = Get_System(SYS_PORTS, PORTS_SYSTEM);
@@ -77,8 +78,8 @@ REBVAL *Append_Event(void)
 
     // Append to tail if room:
     if (SER_FULL(VAL_SERIES(state))) {
-        if (VAL_LEN_HEAD(state) > EVENTS_LIMIT)
-            panic (state);
+        if (VAL_LEN_HEAD(state) >= EVENTS_LIMIT)
+            return 0;
 
         Extend_Series(VAL_SERIES(state), EVENTS_CHUNK);
     }
@@ -174,6 +175,14 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     case SYM_APPEND:
         if (!IS_EVENT(arg))
             fail (arg);
+
+        // Devices queue their events with an INSERT into the System Port,
+        // so this is where the queue's size is enforced.  WAIT stops polling
+        // well before this (see EVENTS_HIGH_WATER), so it takes a runaway
+        // producer to get here.
+        //
+        if (VAL_LEN_HEAD(state) >= EVENTS_LIMIT)
+            fail ("System Port event queue is full (EVENTS_LIMIT)");
         // falls through
     case SYM_PICK: {
     act_blk:;
@@ -156,6 +156,7 @@ extern REB_R TO_Event(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Event(REB_MOLD *mo, const REBCEL *v, bool form);
 extern REBTYPE(Event);
 extern REB_R PD_Event(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
+extern REBVAL *Get_Event_Var(RELVAL *out, const REBCEL *v, REBSTR *name);
 
 // !!! The port scheme is also being included in the extension.
 
@@ -163,6 +164,17 @@ extern REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
 extern void Startup_Event_Scheme(void);
 extern void Shutdown_Event_Scheme(void);
 
+// The event queue is the BLOCK! in the state of the System Port.  When it
+// has EVENTS_HIGH_WATER events, WAIT stops polling devices until the awake
+// handlers have worked it down (so requests stay pending, and e.g. TCP flow
+// control slows the peers) instead of letting it grow without bound.  The
+// room left up to EVENTS_LIMIT is for what one poll of the devices can add;
+// an INSERT into the System Port past that fails.
+//
+#define EVENTS_LIMIT 0xFFFF //64k
+#define EVENTS_HIGH_WATER (EVENTS_LIMIT - 4096)
+#define EVENTS_CHUNK 128
+
 
 ////// GOB! INSIDE KNOWLEDGE ("libGOB") ///////////////////////////////////=//
 //
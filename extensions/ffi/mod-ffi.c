@@ -329,6 +329,148 @@ REBNATIVE(wrap_callback)
 }
 
 
+// State for running the calls of ROUTINE-BATCH under rebRescue(), so that
+// a failure can say which of the calls it happened in.
+//
+struct Reb_Batch_State {
+    REBVAL *out;
+    REBACT *act;
+    REBVAL *args;
+    REBLEN arity;
+    bool grouped;
+    bool is_void;
+    REBLEN index;  // 1-based number of the call being made
+};
+
+static REBVAL *Run_Batch_Dangerous(struct Reb_Batch_State *b)
+{
+    RELVAL *item = VAL_ARRAY_AT(b->args);
+    while (NOT_END(item)) {
+        ++b->index;
+
+        RELVAL *group;
+        if (b->grouped) {
+            if (not IS_BLOCK(item) or VAL_LEN_AT(item) != b->arity)
+                fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(b->args)));
+            group = VAL_ARRAY_AT(item);
+            ++item;
+        }
+        else {
+            group = item;
+            item += b->arity;
+        }
+
+        REBLEN i;
+        for (i = 0; i < b->arity; ++i) {
+            if (IS_RELATIVE(group + i))
+                fail ("ROUTINE-BATCH arguments must not be relative words");
+        }
+
+        // The call may run callbacks that use the data stack, so don't pass
+        // it a pointer into the stack as the output cell.
+        //
+        Call_Fixed_Routine(
+            b->out,
+            b->act,
+            b->arity == 0 ? nullptr : KNOWN(group)
+        );
+        if (not b->is_void)
+            Move_Value(DS_PUSH(), b->out);
+    }
+
+    return nullptr;
+}
+
+
+//
+//  export routine-batch: native [
+//
+//  {Call a routine once for each group of arguments, collecting the results}
+//
+//      return: "Results of the calls, in order (empty if routine is void)"
+//          [block!]
+//      routine "Routine from MAKE-ROUTINE (not variadic)"
+//          [action!]
+//      args "BLOCK!s of arguments, or all arguments flattened (not evaluated)"
+//          [block!]
+//  ]
+//
+REBNATIVE(routine_batch)
+//
+// Invoking a routine from Rebol means building a frame for it and running
+// the evaluator to fill in the arguments, which costs far more than the call
+// of a small C function.  When the same routine is to be called on a lot of
+// data, this goes directly to Call_Fixed_Routine() for each group of
+// argument values, so the only per-call work is converting those values.
+//
+// !!! VECTOR! is implemented by an extension, so for now its elements have
+// to be given here as a BLOCK! (e.g. via TO BLOCK!).
+{
+    FFI_INCLUDE_PARAMS_OF_ROUTINE_BATCH;
+
+    REBVAL *routine = ARG(routine);
+    if (not IS_ACTION_RIN(routine))
+        fail (PAR(routine));
+
+    REBACT *act = VAL_ACTION(routine);
+    REBRIN *rin = ACT_DETAILS(act);
+    if (RIN_IS_CALLBACK(rin) or RIN_IS_VARIADIC(rin))
+        fail ("ROUTINE-BATCH only supports non-variadic MAKE-ROUTINE actions");
+
+    if (RIN_LIB(rin) and IS_LIB_CLOSED(RIN_LIB(rin)))
+        fail (Error_Bad_Library_Raw());
+
+    REBLEN arity = RIN_NUM_FIXED_ARGS(rin);
+    bool is_void = IS_BLANK(RIN_RET_SCHEMA(rin));
+
+    // The cells are handed to the routine directly (a REBVAL* argument gets
+    // a pointer to them), so they can't be relative to a function body.
+    //
+    REBVAL *args = ARG(args);
+    bool grouped = (VAL_LEN_AT(args) != 0 and IS_BLOCK(VAL_ARRAY_AT(args)));
+    if (not grouped and (arity == 0 or VAL_LEN_AT(args) % arity != 0))
+        fail ("ROUTINE-BATCH needs a multiple of the routine's arity in ARGS");
+
+    REBDSP dsp_orig = DSP;
+
+    struct Reb_Batch_State b;
+    b.out = D_OUT;
+    b.act = act;
+    b.args = args;
+    b.arity = arity;
+    b.grouped = grouped;
+    b.is_void = is_void;
+    b.index = 0;
+
+    // Errors raised during a call would otherwise be reported as coming from
+    // ROUTINE-BATCH itself, with nothing to say which group of arguments
+    // was bad.  A single rescue around all the calls costs only one setjmp.
+    //
+    REBVAL *error = rebRescue(cast(REBDNG*, &Run_Batch_Dangerous), &b);
+    if (error) {
+        REBCTX *ctx = VAL_CONTEXT(error);
+        ERROR_VARS *vars = ERR_VARS(ctx);
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+        if (IS_BLOCK(&vars->message))
+            Form_Array_At(mo, VAL_ARRAY(&vars->message), 0, ctx);
+        else
+            Form_Value(mo, KNOWN(&vars->message));
+
+        DECLARE_LOCAL (message);
+        Init_Text(message, Pop_Molded_String(mo));
+        rebRelease(error);
+
+        DECLARE_LOCAL (index);
+        Init_Integer(index, b.index);
+        fail (Error_Bad_Batch_Call_Raw(index, message));
+    }
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+}
+
+
 //
 //  export addr-of: native [
 //
@@ -394,9 +394,45 @@ enum {
     //
     IDX_ROUTINE_CLOSURE = 8,
 
+    // A HANDLE! holding a C array of size_t, which is the precomputed layout
+    // of where the return value and each argument go in the buffer that is
+    // passed to ffi_call() (see IDX_LAYOUT_XXX).  BLANK! if variadic.
+    //
+    IDX_ROUTINE_LAYOUT = 9,
+
+    // A HANDLE! holding a Reb_Cif_Cache of CIFs for the variadic call shapes
+    // this routine has been called with recently.  BLANK! if not variadic.
+    //
+    IDX_ROUTINE_CIF_CACHE = 10,
+
     IDX_ROUTINE_MAX
 };
 
+enum {
+    IDX_LAYOUT_SIZE = 0,  // total bytes for return value and all arguments
+    IDX_LAYOUT_RET = 1,  // offset of return value (0 if void)
+    IDX_LAYOUT_ARGS = 2  // offsets of the arguments start here
+};
+
+// Making a CIF with ffi_prep_cif_var() for every call of a variadic routine
+// is costly, and calls tend to repeat the same few argument types (e.g. the
+// format strings given to a printf() in a loop).  So recent CIFs are kept
+// per routine, looked up by the exact list of argument ffi_type*s.
+//
+#define ROUTINE_CIF_CACHE_SIZE 8
+
+struct Reb_Cif_Cache_Entry {
+    ffi_type **args_fftypes;  // nullptr if unused; must outlive the `cif`
+    REBLEN num_args;  // fixed + variable
+    REBLEN busy;  // calls in progress (a callback may re-enter the routine)
+    ffi_cif cif;
+};
+
+struct Reb_Cif_Cache {
+    REBLEN next;  // round-robin choice of the entry to replace
+    struct Reb_Cif_Cache_Entry entries[ROUTINE_CIF_CACHE_SIZE];
+};
+
 #define RIN_AT(a, n) \
     SER_AT(REBVAL, SER(a), (n)) // locate index access
 
@@ -453,6 +489,16 @@ inline static ffi_type** RIN_ARG_FFTYPES(REBRIN *r) {
 inline static bool RIN_IS_VARIADIC(REBRIN *r)
     { return VAL_LOGIC(RIN_AT(r, IDX_ROUTINE_IS_VARIADIC)); }
 
+inline static size_t *RIN_LAYOUT(REBRIN *r)
+    { return VAL_HANDLE_POINTER(size_t, RIN_AT(r, IDX_ROUTINE_LAYOUT)); }
+
+inline static struct Reb_Cif_Cache *RIN_CIF_CACHE(REBRIN *r) {
+    return VAL_HANDLE_POINTER(
+        struct Reb_Cif_Cache,
+        RIN_AT(r, IDX_ROUTINE_CIF_CACHE)
+    );
+}
+
 
 // !!! FORWARD DECLARATIONS
 //
@@ -480,6 +526,7 @@ extern void TO_Struct(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Struct(REB_MOLD *mo, const REBCEL *v, bool form);
 
 extern const REBVAL *Routine_Dispatcher(REBFRM *f);
+extern void Call_Fixed_Routine(REBVAL *out, REBACT *act, const REBVAL *args);
 
 inline static bool IS_ACTION_RIN(const RELVAL *v)
     { return VAL_ACT_DISPATCHER(v) == &Routine_Dispatcher; }
@@ -204,6 +204,29 @@ inline static void *Expand_And_Align(
 }
 
 
+//
+// When a routine is called normally, the frame on top of the stack is the
+// routine's own, and the error names it.  ROUTINE-BATCH calls routines
+// without making a frame for them, so the error can't be blamed on the
+// frame on top (it's for ROUTINE-BATCH, which has no such argument).
+//
+static REBCTX *Error_Routine_Arg_Type(
+    const REBVAL *param,
+    const REBVAL *arg
+){
+    REBFRM *f = FS_TOP;
+    if (ACT_DISPATCHER(FRM_PHASE(f)) == &Routine_Dispatcher)
+        return Error_Arg_Type(f, param, VAL_TYPE(arg));
+
+    DECLARE_LOCAL (param_word);
+    Init_Word(param_word, VAL_PARAM_SPELLING(param));
+    return Error_Bad_Routine_Arg_Raw(
+        Datatype_From_Kind(VAL_TYPE(arg)),
+        param_word
+    );
+}
+
+
 //
 // Convert a Rebol value into a bit pattern suitable for the expectations of
 // the FFI for how a C argument would be represented.  (e.g. turn an
@@ -237,8 +260,6 @@ static uintptr_t arg_to_ffi(
         assert(arg == NULL); // return value, so just make space (no arg data)
 #endif
 
-    REBFRM *frame_ = FS_TOP; // So you can use the D_xxx macros
-
     uintptr_t offset;
     if (dest == NULL)
         offset = 0;
@@ -281,10 +302,10 @@ static uintptr_t arg_to_ffi(
         // because it couldn't do so in the return case where arg was null)
 
         if (!IS_STRUCT(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         if (STU_SIZE(VAL_STRUCT(arg)) != FLD_WIDE(top))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         memcpy(dest, VAL_STRUCT_DATA_AT(arg), STU_SIZE(VAL_STRUCT(arg)));
 
@@ -301,7 +322,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         u = cast(uint8_t, VAL_INT64(arg));
         memcpy(dest, &u, sizeof(u));
@@ -314,7 +335,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         i = cast(int8_t, VAL_INT64(arg));
         memcpy(dest, &i, sizeof(i));
@@ -327,7 +348,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         u = cast(uint16_t, VAL_INT64(arg));
         memcpy(dest, &u, sizeof(u));
@@ -340,7 +361,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         i = cast(int16_t, VAL_INT64(arg));
         memcpy(dest, &i, sizeof(i));
@@ -353,7 +374,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         u = cast(uint32_t, VAL_INT64(arg));
         memcpy(dest, &u, sizeof(u));
@@ -366,7 +387,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         i = cast(int32_t, VAL_INT64(arg));
         memcpy(dest, &i, sizeof(i));
@@ -380,7 +401,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_INTEGER(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         i = VAL_INT64(arg);
         memcpy(dest, &i, sizeof(int64_t));
@@ -435,7 +456,7 @@ static uintptr_t arg_to_ffi(
             break;}
 
         default:
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
         }
         break;} // end case FFI_TYPE_POINTER
 
@@ -454,7 +475,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_DECIMAL(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         f = cast(float, VAL_DECIMAL(arg));
         memcpy(dest, &f, sizeof(f));
@@ -467,7 +488,7 @@ static uintptr_t arg_to_ffi(
         if (!arg) break;
 
         if (!IS_DECIMAL(arg))
-            fail (Error_Arg_Type(D_FRAME, param, VAL_TYPE(arg)));
+            fail (Error_Routine_Arg_Type(param, arg));
 
         d = VAL_DECIMAL(arg);
         memcpy(dest, &d, sizeof(double));
@@ -588,6 +609,178 @@ static void ffi_to_rebol(
 }
 
 
+// Most routines take a handful of scalar arguments, so the bytes for their
+// C representations fit in a small buffer on the C stack.  Anything larger
+// is allocated.
+//
+#define ROUTINE_STACK_BUF_SIZE 256
+#define ROUTINE_STACK_MAX_ARGS 16
+
+
+//
+//  Call_Fixed_Routine: C
+//
+// A routine that isn't variadic has its CIF made once at MAKE-ROUTINE time,
+// along with a layout saying where each converted argument goes in the
+// buffer passed to ffi_call() (see IDX_ROUTINE_LAYOUT).  So calling it only
+// needs the conversions themselves--no series are allocated to accumulate
+// the arguments, and no offsets are fixed up into pointers afterward.
+//
+// This is split out from Routine_Dispatcher() so that ROUTINE-BATCH can call
+// a routine many times without building a frame for each call.  The `args`
+// are expected to stay alive during the call (they aren't copied, which is
+// important for the REBVAL* schema that passes pointers to the cells).
+//
+void Call_Fixed_Routine(
+    REBVAL *out,
+    REBACT *act,
+    const REBVAL *args  // RIN_NUM_FIXED_ARGS() of them, contiguous
+){
+    REBRIN *rin = ACT_DETAILS(act);
+    assert(not RIN_IS_VARIADIC(rin));
+
+    REBLEN num_args = RIN_NUM_FIXED_ARGS(rin);
+    size_t *layout = RIN_LAYOUT(rin);
+
+    // The union members make the buffer aligned for any fundamental C type,
+    // which libffi's own alignment requirements never exceed.
+    //
+    union {
+        REBYTE bytes[ROUTINE_STACK_BUF_SIZE];
+        double d;
+        long double ld;
+        int64_t i;
+        void *p;
+    } stack_buf;
+    void *stack_ptrs[ROUTINE_STACK_MAX_ARGS];
+
+    REBYTE *buf;
+    if (layout[IDX_LAYOUT_SIZE] <= sizeof(stack_buf))
+        buf = stack_buf.bytes;
+    else
+        buf = rebAllocN(REBYTE, layout[IDX_LAYOUT_SIZE]);  // freed if fail()
+
+    void **arg_ptrs;
+    if (num_args <= ROUTINE_STACK_MAX_ARGS)
+        arg_ptrs = stack_ptrs;
+    else
+        arg_ptrs = rebAllocN(void*, num_args);
+
+    // The arguments are known to be of correct general types if they came
+    // from a frame (they were checked by Eval_Core for the call).  But a
+    // STRUCT! might not be compatible with the type of STRUCT! in the
+    // parameter specification, or an INTEGER! may be out of range for the C
+    // type.  arg_to_ffi() checks all of that, and could fail() here.
+    //
+    REBLEN i;
+    for (i = 0; i < num_args; ++i) {
+        arg_ptrs[i] = buf + layout[IDX_LAYOUT_ARGS + i];
+        arg_to_ffi(
+            NULL, // store must be NULL if dest is non-NULL
+            arg_ptrs[i], // dest
+            &args[i],
+            RIN_ARG_SCHEMA(rin, i), // 0-based
+            ACT_PARAM(act, i + 1) // 1-based
+        );
+    }
+
+    void *ret;
+    if (IS_BLANK(RIN_RET_SCHEMA(rin)))
+        ret = NULL;
+    else
+        ret = buf + layout[IDX_LAYOUT_RET];
+
+    // THE ACTUAL FFI CALL
+    //
+    // (See notes in Routine_Dispatcher() about callbacks that fail.)
+    //
+    ffi_call(
+        RIN_CIF(rin),
+        RIN_CFUNC(rin),
+        ret,
+        (num_args == 0) ? NULL : arg_ptrs
+    );
+
+    if (IS_BLANK(RIN_RET_SCHEMA(rin)))
+        Init_Nulled(out);
+    else
+        ffi_to_rebol(out, RIN_RET_SCHEMA(rin), ret);
+
+    if (arg_ptrs != stack_ptrs)
+        rebFree(arg_ptrs);
+    if (buf != stack_buf.bytes)
+        rebFree(buf);
+}
+
+
+// Find a CIF in the routine's cache matching the argument types, or make one
+// (replacing the least recently made entry that isn't in use).  Returns
+// nullptr if every entry is busy, in which case the caller makes its own.
+//
+static struct Reb_Cif_Cache_Entry *Cif_Cache_Entry_For_Call(
+    REBRIN *rin,
+    ffi_type **args_fftypes,
+    REBLEN num_fixed,
+    REBLEN num_args
+){
+    struct Reb_Cif_Cache *cache = RIN_CIF_CACHE(rin);
+
+    REBLEN n;
+    for (n = 0; n < ROUTINE_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *e = &cache->entries[n];
+        if (
+            e->args_fftypes
+            and e->num_args == num_args
+            and 0 == memcmp(
+                e->args_fftypes,
+                args_fftypes,
+                sizeof(ffi_type*) * num_args
+            )
+        ){
+            return e;
+        }
+    }
+
+    struct Reb_Cif_Cache_Entry *e = nullptr;
+    for (n = 0; n < ROUTINE_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *candidate = &cache->entries[cache->next];
+        cache->next = (cache->next + 1) % ROUTINE_CIF_CACHE_SIZE;
+        if (candidate->busy == 0) {
+            e = candidate;
+            break;
+        }
+    }
+    if (not e)
+        return nullptr;
+
+    if (e->args_fftypes)
+        FREE_N(ffi_type*, e->num_args, e->args_fftypes);
+
+    e->num_args = num_args;
+    e->args_fftypes = ALLOC_N(ffi_type*, num_args);
+    memcpy(e->args_fftypes, args_fftypes, sizeof(ffi_type*) * num_args);
+
+    ffi_status status = ffi_prep_cif_var(
+        &e->cif,
+        RIN_ABI(rin),
+        num_fixed,
+        num_args,
+        IS_BLANK(RIN_RET_SCHEMA(rin))
+            ? &ffi_type_void
+            : SCHEMA_FFTYPE(RIN_RET_SCHEMA(rin)),
+        e->args_fftypes
+    );
+
+    if (status != FFI_OK) {
+        FREE_N(ffi_type*, e->num_args, e->args_fftypes);
+        e->args_fftypes = nullptr;
+        fail ("FFI: Couldn't prep CIF_VAR");
+    }
+
+    return e;
+}
+
+
 //
 //  Routine_Dispatcher: C
 //
@@ -607,12 +800,19 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
 
     REBLEN num_fixed = RIN_NUM_FIXED_ARGS(rin);
 
+    if (not RIN_IS_VARIADIC(rin)) {
+        Call_Fixed_Routine(
+            f->out,
+            FRM_PHASE(f),
+            num_fixed == 0 ? nullptr : FRM_ARG(f, 1)  // args are contiguous
+        );
+        return f->out;  // Note: cannot "throw" across an FFI boundary
+    }
+
     REBLEN num_variable;
     REBDSP dsp_orig = DSP; // variadic args pushed to stack, so save base ptr
 
-    if (!RIN_IS_VARIADIC(rin))
-        num_variable = 0;
-    else {
+    {
         // The function specification should have one extra parameter for
         // the variadic source ("...")
         //
@@ -728,19 +928,16 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
     }
 
     // If an FFI routine takes a fixed number of arguments, then its Call
-    // InterFace (CIF) can be created just once.  This will be in the RIN_CIF.
+    // InterFace (CIF) can be created just once (see Call_Fixed_Routine()).
     // However a variadic routine requires a CIF that matches the number
-    // and types of arguments for that specific call.
+    // and types of arguments for that specific call.  Those are looked up in
+    // the routine's CIF cache when possible, else made just for this call.
     //
-    // These pointers need to be freed by HANDLE! cleanup.
-    //
-    ffi_cif *cif; // pre-made if not variadic, built for this call otherwise
+    ffi_cif *cif;
     ffi_type **args_fftypes = NULL; // ffi_type*[] if num_variable > 0
+    struct Reb_Cif_Cache_Entry *entry = nullptr; // if cif is from the cache
 
-    if (!RIN_IS_VARIADIC(rin)) {
-        cif = RIN_CIF(rin);
-    }
-    else {
+    {
         assert(IS_BLANK(RIN_AT(rin, IDX_ROUTINE_CIF)));
 
         // CIF creation requires a C array of argument descriptions that is
@@ -756,6 +953,12 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
         DECLARE_LOCAL (schema);
         DECLARE_LOCAL (param);
 
+        // Only fundamental types (WORD! schemas) have ffi_type*s that are the
+        // same from call to call.  A STRUCT! type given in the variadic part
+        // makes a new ffi_type each time, so such calls can't use the cache.
+        //
+        bool cacheable = true;
+
         REBDSP dsp;
         for (dsp = dsp_orig + 1; i < num_args; dsp += 2, ++i) {
             //
@@ -773,6 +976,8 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
             );
 
             args_fftypes[i] = SCHEMA_FFTYPE(schema);
+            if (not IS_WORD(schema))
+                cacheable = false;
 
             *SER_AT(void*, arg_offsets, i) = cast(void*, arg_to_ffi(
                 store, // data appended to store
@@ -785,23 +990,40 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
 
         DS_DROP_TO(dsp_orig); // done w/args (converted to bytes in `store`)
 
-        cif = rebAlloc(ffi_cif);
+        if (cacheable and num_args != 0)
+            entry = Cif_Cache_Entry_For_Call(
+                rin,
+                args_fftypes,
+                num_fixed,
+                num_args
+            );
 
-        ffi_status status = ffi_prep_cif_var( // "_var"-iadic prep_cif version
-            cif,
-            RIN_ABI(rin),
-            num_fixed, // just fixed
-            num_args, // fixed plus variable
-            IS_BLANK(RIN_RET_SCHEMA(rin))
-                ? &ffi_type_void
-                : SCHEMA_FFTYPE(RIN_RET_SCHEMA(rin)), // return FFI type
-            args_fftypes // arguments FFI types
-        );
+        if (entry) {
+            cif = &entry->cif;
+            ++entry->busy;  // don't let a re-entrant call replace it
+
+            rebFree(args_fftypes); // cache entry has its own copy
+            args_fftypes = NULL;
+        }
+        else {
+            cif = rebAlloc(ffi_cif);
 
-        if (status != FFI_OK) {
-            rebFree(cif); // would free automatically on fail
-            rebFree(args_fftypes); // would free automatically on fail
-            fail ("FFI: Couldn't prep CIF_VAR");
+            ffi_status status = ffi_prep_cif_var( // "_var"-iadic prep_cif
+                cif,
+                RIN_ABI(rin),
+                num_fixed, // just fixed
+                num_args, // fixed plus variable
+                IS_BLANK(RIN_RET_SCHEMA(rin))
+                    ? &ffi_type_void
+                    : SCHEMA_FFTYPE(RIN_RET_SCHEMA(rin)), // return FFI type
+                args_fftypes // arguments FFI types
+            );
+
+            if (status != FFI_OK) {
+                rebFree(cif); // would free automatically on fail
+                rebFree(args_fftypes); // would free automatically on fail
+                fail ("FFI: Couldn't prep CIF_VAR");
+            }
         }
     }
 
@@ -850,7 +1072,9 @@ const REBVAL *Routine_Dispatcher(REBFRM *f)
 
     Free_Unmanaged_Series(store);
 
-    if (num_variable != 0) {
+    if (entry)
+        --entry->busy;
+    else {
         rebFree(cif);
         rebFree(args_fftypes);
     }
@@ -881,6 +1105,24 @@ static void cleanup_args_fftypes(const REBVAL *v) {
     FREE_N(ffi_type*, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(ffi_type*, v));
 }
 
+static void cleanup_layout(const REBVAL *v) {
+    FREE_N(size_t, VAL_HANDLE_LEN(v), VAL_HANDLE_POINTER(size_t, v));
+}
+
+static void cleanup_cif_cache(const REBVAL *v) {
+    struct Reb_Cif_Cache *cache = VAL_HANDLE_POINTER(struct Reb_Cif_Cache, v);
+
+    REBLEN n;
+    for (n = 0; n < ROUTINE_CIF_CACHE_SIZE; ++n) {
+        struct Reb_Cif_Cache_Entry *e = &cache->entries[n];
+        assert(e->busy == 0);
+        if (e->args_fftypes)
+            FREE_N(ffi_type*, e->num_args, e->args_fftypes);
+    }
+
+    FREE(struct Reb_Cif_Cache, cache);
+}
+
 
 struct Reb_Callback_Invocation {
     ffi_cif *cif;
@@ -1160,6 +1402,24 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
         //
         Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF));
         Init_Blank(RIN_AT(r, IDX_ROUTINE_ARG_FFTYPES));
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_LAYOUT));
+
+        struct Reb_Cif_Cache *cache = ALLOC(struct Reb_Cif_Cache);
+        cache->next = 0;
+
+        REBLEN n;
+        for (n = 0; n < ROUTINE_CIF_CACHE_SIZE; ++n) {
+            cache->entries[n].args_fftypes = nullptr;
+            cache->entries[n].num_args = 0;
+            cache->entries[n].busy = 0;
+        }
+
+        Init_Handle_Cdata_Managed(
+            RIN_AT(r, IDX_ROUTINE_CIF_CACHE),
+            cache,
+            1,
+            &cleanup_cif_cache
+        );
     }
     else {
         // The same CIF can be used for every call of the routine if it is
@@ -1208,6 +1468,44 @@ REBACT *Alloc_Ffi_Action_For_Spec(REBVAL *ffi_spec, ffi_abi abi) {
                 num_fixed,
                 &cleanup_args_fftypes
             ); // lifetime must match cif lifetime
+
+        // Since the argument types never change, where each converted
+        // argument lives in the marshaling buffer can be decided now instead
+        // of on each call.  ffi_prep_cif() has filled in the size and
+        // alignment of any struct types by this point.
+        //
+        // libffi writes integral return values as a full ffi_arg, even when
+        // the C type is smaller, so the return slot is at least that big.
+        //
+        size_t *layout = ALLOC_N(size_t, IDX_LAYOUT_ARGS + num_fixed);
+        size_t offset = 0;
+
+        layout[IDX_LAYOUT_RET] = 0;  // return value goes first (if any)
+        if (not IS_BLANK(RIN_RET_SCHEMA(r))) {
+            offset = cif->rtype->size;
+            if (offset < sizeof(ffi_arg))
+                offset = sizeof(ffi_arg);
+        }
+
+        for (i = 0; i < num_fixed; ++i) {
+            size_t align = cif->arg_types[i]->alignment;
+            if (align == 0)
+                align = 1;
+            offset = (offset + align - 1) / align * align;
+            layout[IDX_LAYOUT_ARGS + i] = offset;
+            offset += cif->arg_types[i]->size;
+        }
+
+        layout[IDX_LAYOUT_SIZE] = offset;
+
+        Init_Handle_Cdata_Managed(
+            RIN_AT(r, IDX_ROUTINE_LAYOUT),
+            layout,
+            IDX_LAYOUT_ARGS + num_fixed,
+            &cleanup_layout
+        );
+
+        Init_Blank(RIN_AT(r, IDX_ROUTINE_CIF_CACHE));
     }
 
     TERM_ARRAY_LEN(r, IDX_ROUTINE_MAX);
@@ -495,6 +495,7 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         INCLUDE_PARAMS_OF_COPY;
 
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // data is freshly read from the file
 
         if (REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
@@ -4,6 +4,7 @@ name: 'Image
 source: %image/mod-image.c
 depends: [
     %image/t-image.c
+    %image/u-image.c
 ]
 includes: [%prep/extensions/image]
 definitions: []
@@ -81,3 +81,161 @@ REBNATIVE(unregister_image_hooks)
 
     return Init_Void(D_OUT);
 }
+
+
+//
+//  resize-image: native [
+//
+//  {Make a copy of an image resampled to a new size}
+//
+//      return: [image!]
+//      image [image!]
+//      size [pair!]
+//      /filter "NEAREST, BILINEAR (the default) or LANCZOS (sharpest)"
+//          [word!]
+//  ]
+//
+REBNATIVE(resize_image)
+//
+// Shrinking with BILINEAR or LANCZOS averages over all the pixels that each
+// output pixel covers, so it doesn't alias the way sampling with a fixed
+// size of filter would.  Images that aren't fully opaque are resampled with
+// premultiplied alpha.
+{
+    IMAGE_INCLUDE_PARAMS_OF_RESIZE_IMAGE;
+
+    REBVAL *image = ARG(image);
+    REBINT src_w = VAL_IMAGE_WIDTH(image);
+    REBINT src_h = VAL_IMAGE_HEIGHT(image);
+    if (src_w <= 0 or src_h <= 0)
+        fail (PAR(image));
+
+    REBINT w = VAL_PAIR_X_INT(ARG(size));
+    REBINT h = VAL_PAIR_Y_INT(ARG(size));
+    if (w <= 0 or h <= 0)
+        fail (PAR(size));
+
+    enum Reb_Resample_Filter filter = RESAMPLE_BILINEAR;
+    if (REF(filter)) {
+        switch (VAL_WORD_SYM(ARG(filter))) {
+          case SYM_NEAREST: filter = RESAMPLE_NEAREST; break;
+          case SYM_BILINEAR: filter = RESAMPLE_BILINEAR; break;
+          case SYM_LANCZOS: filter = RESAMPLE_LANCZOS; break;
+          default:
+            fail (PAR(filter));
+        }
+    }
+
+    Init_Image_Black_Opaque(D_OUT, w, h);
+    Resample_RGBA(
+        VAL_IMAGE_HEAD(D_OUT), w, h,
+        VAL_IMAGE_HEAD(image), src_w, src_h,
+        filter
+    );
+    return D_OUT;
+}
+
+
+//
+//  composite-image: native [
+//
+//  {Draw a source image over an image (modified), blending by alpha}
+//
+//      return: [image!]
+//      image [image!]
+//      source [image!]
+//      /at "Position in IMAGE of the top left of SOURCE (default is 0x0)"
+//          [pair!]
+//  ]
+//
+REBNATIVE(composite_image)
+//
+// Parts of SOURCE that fall outside of IMAGE are clipped.
+{
+    IMAGE_INCLUDE_PARAMS_OF_COMPOSITE_IMAGE;
+
+    REBVAL *image = ARG(image);
+    REBVAL *source = ARG(source);
+    FAIL_IF_READ_ONLY(image);
+
+    REBINT x = 0;
+    REBINT y = 0;
+    if (REF(at)) {
+        x = VAL_PAIR_X_INT(ARG(at));
+        y = VAL_PAIR_Y_INT(ARG(at));
+    }
+
+    REBINT sx = x < 0 ? -x : 0;  // first pixel of source drawn
+    REBINT sy = y < 0 ? -y : 0;
+    REBINT dx = x < 0 ? 0 : x;  // where it goes in the image
+    REBINT dy = y < 0 ? 0 : y;
+    REBINT w = MIN(
+        VAL_IMAGE_WIDTH(source) - sx, VAL_IMAGE_WIDTH(image) - dx
+    );
+    REBINT h = MIN(
+        VAL_IMAGE_HEIGHT(source) - sy, VAL_IMAGE_HEIGHT(image) - dy
+    );
+
+    if (w > 0 and h > 0)
+        Composite_RGBA(
+            VAL_IMAGE_HEAD(image)
+                + (dy * VAL_IMAGE_WIDTH(image) + dx) * 4,
+            VAL_IMAGE_WIDTH(image),
+            VAL_IMAGE_HEAD(source)
+                + (sy * VAL_IMAGE_WIDTH(source) + sx) * 4,
+            VAL_IMAGE_WIDTH(source),
+            w,
+            h
+        );
+
+    RETURN (image);
+}
+
+
+//
+//  premultiply-image: native [
+//
+//  {Scale the colors of an image (modified) by their alpha}
+//
+//      return: [image!]
+//      image [image!]
+//      /undo "Divide the colors by their alpha instead"
+//  ]
+//
+REBNATIVE(premultiply_image)
+{
+    IMAGE_INCLUDE_PARAMS_OF_PREMULTIPLY_IMAGE;
+
+    REBVAL *image = ARG(image);
+    FAIL_IF_READ_ONLY(image);
+
+    if (REF(undo))
+        Unpremultiply_Alpha(VAL_IMAGE_HEAD(image), VAL_IMAGE_LEN_HEAD(image));
+    else
+        Premultiply_Alpha(VAL_IMAGE_HEAD(image), VAL_IMAGE_LEN_HEAD(image));
+
+    RETURN (image);
+}
+
+
+//
+//  grayscale-image: native [
+//
+//  {Make a copy of an image in shades of gray (keeping the alpha)}
+//
+//      return: [image!]
+//      image [image!]
+//  ]
+//
+REBNATIVE(grayscale_image)
+{
+    IMAGE_INCLUDE_PARAMS_OF_GRAYSCALE_IMAGE;
+
+    REBVAL *image = ARG(image);
+    REBINT w = VAL_IMAGE_WIDTH(image);
+    REBINT h = VAL_IMAGE_HEIGHT(image);
+
+    Init_Image_Black_Opaque(D_OUT, w, h);
+    Grayscale_RGBA(VAL_IMAGE_HEAD(D_OUT), VAL_IMAGE_HEAD(image), w * h);
+    return D_OUT;
+}
@@ -145,3 +145,26 @@ extern REB_R TO_Image(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Image(REB_MOLD *mo, const REBCEL *v, bool form);
 extern REBTYPE(Image);
 extern REB_R PD_Image(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
+
+
+// Kernels for the natives that work on whole images, see %u-image.c
+//
+enum Reb_Resample_Filter {
+    RESAMPLE_NEAREST,
+    RESAMPLE_BILINEAR,
+    RESAMPLE_LANCZOS
+};
+
+extern void Premultiply_Alpha(REBYTE *rgba, REBLEN num_pixels);
+extern void Unpremultiply_Alpha(REBYTE *rgba, REBLEN num_pixels);
+extern void Grayscale_RGBA(REBYTE *dst, const REBYTE *src, REBLEN num_pixels);
+extern void Composite_RGBA(
+    REBYTE *dst, REBINT dst_stride,
+    const REBYTE *src, REBINT src_stride,
+    REBINT w, REBINT h
+);
+extern void Resample_RGBA(
+    REBYTE *dst, REBINT dst_w, REBINT dst_h,
+    const REBYTE *src, REBINT src_w, REBINT src_h,
+    enum Reb_Resample_Filter filter
+);
@@ -1107,6 +1107,7 @@ REBTYPE(Image)
         INCLUDE_PARAMS_OF_COPY;
 
         UNUSED(PAR(value));
+        UNUSED(REF(share));
 
         if (REF(deep))
             fail (Error_Bad_Refines_Raw());
@@ -0,0 +1,737 @@
+//
+//  File: %u-image.c
+//  Summary: "resampling, compositing and conversion kernels for IMAGE!"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// These routines work on raw RGBA bytes (alpha of 255 is opaque), so the
+// natives in %mod-image.c do the checking of IMAGE! values and sizes.
+//
+// The loops that touch every pixel have SSE2 versions on x86-64, where SSE2
+// is always available (CPU_X86_SSE2 in %sys-cpu.h, with no CPUID check).
+// Each gives exactly the same bytes as the C version that follows it: the
+// arithmetic is integer with the same rounding, just done on several
+// channels at once.
+//
+// The resampler does each row independently, so Resample_RGBA() splits its
+// passes into bands of rows for Run_Tasks() (see %c-thread.c), which does
+// them on up to TASK-THREADS threads.  The band tasks only read and write
+// the raw bytes they are given; everything that allocates is done before.
+//
+
+#include "sys-core.h"
+
+#include "sys-image.h"
+
+
+// Division by 255 with rounding, exact for 0 <= x <= 255 * 255.
+//
+#define DIV_255(x) \
+    (((x) + 128 + (((x) + 128) >> 8)) >> 8)
+
+#ifdef CPU_X86_SSE2
+    //
+    // The same on 16-bit lanes, where x + 128 + (x + 128) / 256 still fits.
+    //
+    inline static __m128i Div_255_Epu16(__m128i x) {
+        x = _mm_add_epi16(x, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+    }
+
+    // Load 1 or 2 pixels (the rest of the register is zero).
+    //
+    inline static __m128i Load_Pixels(const REBYTE *p, REBINT n) {
+        if (n == 2)
+            return _mm_loadl_epi64((const __m128i*)p);
+        int32_t pixel;
+        memcpy(&pixel, p, 4);
+        return _mm_cvtsi32_si128(pixel);
+    }
+
+    // Two weights, repeated for each pair of 16-bit lanes (for PMADDWD).
+    //
+    inline static __m128i Weight_Pair(int16_t k0, int16_t k1) {
+        return _mm_set1_epi32(cast(int32_t,
+            cast(uint32_t, cast(uint16_t, k0))
+                | (cast(uint32_t, cast(uint16_t, k1)) << 16)
+        ));
+    }
+#endif
+
+
+//
+//  Premultiply_Alpha: C
+//
+// Scale the color channels by alpha, as resampling and compositing need so
+// that the color of transparent pixels doesn't bleed into opaque ones.
+//
+void Premultiply_Alpha(REBYTE *rgba, REBLEN num_pixels)
+{
+    REBLEN i = 0;
+
+  #ifdef CPU_X86_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(cast(int32_t, 0xFF000000));
+
+    for (; i + 4 <= num_pixels; i += 4) {
+        REBYTE *p = rgba + i * 4;
+        __m128i pixels = _mm_loadu_si128((const __m128i*)p);
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+        __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+        __m128i lo_a = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(lo, 0xFF), 0xFF
+        );
+        __m128i hi_a = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(hi, 0xFF), 0xFF
+        );
+        lo = Div_255_Epu16(_mm_mullo_epi16(lo, lo_a));
+        hi = Div_255_Epu16(_mm_mullo_epi16(hi, hi_a));
+        __m128i out = _mm_or_si128(
+            _mm_andnot_si128(alpha_mask, _mm_packus_epi16(lo, hi)),
+            _mm_and_si128(alpha_mask, pixels)
+        );
+        _mm_storeu_si128((__m128i*)p, out);
+    }
+  #endif
+
+    for (; i < num_pixels; ++i) {
+        REBYTE *p = rgba + i * 4;
+        REBLEN a = p[3];
+        p[0] = cast(REBYTE, DIV_255(p[0] * a));
+        p[1] = cast(REBYTE, DIV_255(p[1] * a));
+        p[2] = cast(REBYTE, DIV_255(p[2] * a));
+    }
+}
+
+
+//
+//  Unpremultiply_Alpha: C
+//
+// Undo Premultiply_Alpha() (as far as 8 bits allow).  Each alpha's scale is
+// computed once as 16.16 fixed point instead of dividing every channel.
+//
+void Unpremultiply_Alpha(REBYTE *rgba, REBLEN num_pixels)
+{
+    uint32_t scale[256];
+    scale[0] = 0;
+    REBLEN a;
+    for (a = 1; a < 256; ++a)
+        scale[a] = ((255 << 16) + a / 2) / a;
+
+    REBLEN i;
+    for (i = 0; i < num_pixels; ++i) {
+        REBYTE *p = rgba + i * 4;
+        a = p[3];
+        if (a == 255)
+            continue;
+
+        REBLEN c;
+        for (c = 0; c < 3; ++c) {
+            uint32_t v = (p[c] * scale[a] + 32768) >> 16;
+            p[c] = cast(REBYTE, v > 255 ? 255 : v);
+        }
+    }
+}
+
+
+//
+//  Grayscale_RGBA: C
+//
+// Luma from the ITU-R BT.601 weights (as JPEG uses), scaled to sum to 256.
+// Alpha is kept.  The source and destination may be the same.
+//
+void Grayscale_RGBA(REBYTE *dst, const REBYTE *src, REBLEN num_pixels)
+{
+    REBLEN i = 0;
+
+  #ifdef CPU_X86_SSE2
+    const __m128i byte = _mm_set1_epi32(0xFF);
+    const __m128i alpha_mask = _mm_set1_epi32(cast(int32_t, 0xFF000000));
+
+    for (; i + 4 <= num_pixels; i += 4) {
+        __m128i pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+        __m128i r = _mm_and_si128(pixels, byte);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 8), byte);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 16), byte);
+        __m128i y = _mm_add_epi32(
+            _mm_add_epi32(
+                _mm_mullo_epi16(r, _mm_set1_epi32(77)),
+                _mm_mullo_epi16(g, _mm_set1_epi32(150))
+            ),
+            _mm_add_epi32(
+                _mm_mullo_epi16(b, _mm_set1_epi32(29)),
+                _mm_set1_epi32(128)
+            )
+        );
+        y = _mm_srli_epi32(y, 8);
+        y = _mm_or_si128(
+            _mm_or_si128(y, _mm_slli_epi32(y, 8)),
+            _mm_slli_epi32(y, 16)
+        );
+        _mm_storeu_si128(
+            (__m128i*)(dst + i * 4),
+            _mm_or_si128(y, _mm_and_si128(pixels, alpha_mask))
+        );
+    }
+  #endif
+
+    for (; i < num_pixels; ++i) {
+        const REBYTE *s = src + i * 4;
+        REBYTE *d = dst + i * 4;
+        REBLEN y = (77 * s[0] + 150 * s[1] + 29 * s[2] + 128) >> 8;
+        d[3] = s[3];
+        d[0] = d[1] = d[2] = cast(REBYTE, y);
+    }
+}
+
+
+//
+//  Composite_RGBA: C
+//
+// Draw `w` x `h` pixels of `src` over `dst` ("source over", with alpha that
+// is not premultiplied).  Strides are in pixels.  Where the destination is
+// opaque the result is round((s * sa + d * (255 - sa)) / 255); elsewhere the
+// color is weighted by the alpha each side contributes.
+//
+void Composite_RGBA(
+    REBYTE *dst,
+    REBINT dst_stride,
+    const REBYTE *src,
+    REBINT src_stride,
+    REBINT w,
+    REBINT h
+){
+  #ifdef CPU_X86_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i alpha_mask = _mm_set1_epi32(cast(int32_t, 0xFF000000));
+  #endif
+
+    REBINT y;
+    for (y = 0; y < h; ++y) {
+        const REBYTE *s = src + y * src_stride * 4;
+        REBYTE *d = dst + y * dst_stride * 4;
+        REBINT x = 0;
+
+      #ifdef CPU_X86_SSE2
+        for (; x + 4 <= w; x += 4) {  // 4 pixels over an opaque destination
+            __m128i dp = _mm_loadu_si128((const __m128i*)(d + x * 4));
+            __m128i opaque = _mm_cmpeq_epi32(
+                _mm_and_si128(dp, alpha_mask), alpha_mask
+            );
+            if (_mm_movemask_epi8(opaque) != 0xFFFF)
+                break;  // do the rest of the row one pixel at a time
+            __m128i sp = _mm_loadu_si128((const __m128i*)(s + x * 4));
+            __m128i s_lo = _mm_unpacklo_epi8(sp, zero);
+            __m128i s_hi = _mm_unpackhi_epi8(sp, zero);
+            __m128i a_lo = _mm_shufflehi_epi16(
+                _mm_shufflelo_epi16(s_lo, 0xFF), 0xFF
+            );
+            __m128i a_hi = _mm_shufflehi_epi16(
+                _mm_shufflelo_epi16(s_hi, 0xFF), 0xFF
+            );
+            __m128i lo = _mm_add_epi16(
+                _mm_mullo_epi16(s_lo, a_lo),
+                _mm_mullo_epi16(
+                    _mm_unpacklo_epi8(dp, zero), _mm_sub_epi16(full, a_lo)
+                )
+            );
+            __m128i hi = _mm_add_epi16(
+                _mm_mullo_epi16(s_hi, a_hi),
+                _mm_mullo_epi16(
+                    _mm_unpackhi_epi8(dp, zero), _mm_sub_epi16(full, a_hi)
+                )
+            );
+            __m128i out = _mm_packus_epi16(
+                Div_255_Epu16(lo), Div_255_Epu16(hi)
+            );
+            _mm_storeu_si128(
+                (__m128i*)(d + x * 4), _mm_or_si128(out, alpha_mask)
+            );
+        }
+      #endif
+
+        for (; x < w; ++x) {
+            const REBYTE *sp = s + x * 4;
+            REBYTE *dp = d + x * 4;
+            uint32_t sa = sp[3];
+            uint32_t da = dp[3];
+
+            if (sa == 0)
+                continue;
+            if (sa == 255 or da == 255) {
+                REBLEN c;
+                for (c = 0; c < 3; ++c)
+                    dp[c] = cast(REBYTE,
+                        DIV_255(sp[c] * sa + dp[c] * (255 - sa))
+                    );
+                dp[3] = cast(REBYTE, da == 255 ? 255 : sa);
+                continue;
+            }
+
+            // Alpha of the result times 255, so the divisions round once.
+            //
+            uint32_t sw = sa * 255;
+            uint32_t dw = da * (255 - sa);
+            uint32_t total = sw + dw;
+            REBLEN c;
+            for (c = 0; c < 3; ++c)
+                dp[c] = cast(REBYTE,
+                    (sp[c] * sw + dp[c] * dw + total / 2) / total
+                );
+            dp[3] = cast(REBYTE, DIV_255(total));
+        }
+    }
+}
+
+
+//=//// RESAMPLING ////////////////////////////////////////////////////////=//
+//
+// Resizing is done as a horizontal pass into a temporary image, then a
+// vertical pass.  Each output pixel of a pass is a weighted sum of a run of
+// input pixels; the weights come from the filter centered on the output
+// pixel and stretched by the reduction factor when shrinking (so every input
+// pixel contributes, instead of the filter skipping over some).  Weights are
+// signed 2.14 fixed point, which lets SSE2 multiply and add pairs of them
+// with PMADDWD.  This is the scheme used by Pillow and other libraries.
+//
+
+#define WEIGHT_BITS 14
+
+
+static double Resample_Filter(enum Reb_Resample_Filter filter, double x)
+{
+    if (x < 0)
+        x = -x;
+
+    if (filter == RESAMPLE_BILINEAR)
+        return x < 1.0 ? 1.0 - x : 0.0;
+
+    assert(filter == RESAMPLE_LANCZOS);  // 3 lobes
+    if (x >= 3.0)
+        return 0.0;
+    if (x < 1.0e-8)
+        return 1.0;
+    double pi_x = 3.14159265358979323846 * x;
+    return 3.0 * sin(pi_x) * sin(pi_x / 3.0) / (pi_x * pi_x);
+}
+
+
+// For each output position, fill in bounds[i * 2] with the first input
+// position and bounds[i * 2 + 1] with how many inputs are used, and put
+// their weights at weights[i * ksize].  Returns ksize.
+//
+static REBINT Resample_Weights(
+    REBINT **bounds_out,
+    int16_t **weights_out,
+    REBINT in_size,
+    REBINT out_size,
+    enum Reb_Resample_Filter filter
+){
+    double scale = cast(double, in_size) / out_size;
+    double filterscale = scale < 1.0 ? 1.0 : scale;
+    double support = (filter == RESAMPLE_LANCZOS ? 3.0 : 1.0) * filterscale;
+    REBINT ksize = cast(REBINT, ceil(support)) * 2 + 1;
+
+    REBINT *bounds = rebAllocN(REBINT, out_size * 2);
+    int16_t *weights = rebAllocN(int16_t, out_size * ksize);
+    double *w = rebAllocN(double, ksize);
+
+    REBINT i;
+    for (i = 0; i < out_size; ++i) {
+        double center = (i + 0.5) * scale;
+
+        REBINT min = cast(REBINT, center - support + 0.5);
+        if (min < 0)
+            min = 0;
+        REBINT max = cast(REBINT, center + support + 0.5);
+        if (max > in_size)
+            max = in_size;
+        REBINT count = max - min;
+        if (count > ksize)
+            count = ksize;
+
+        double total = 0.0;
+        REBINT k;
+        for (k = 0; k < count; ++k) {
+            w[k] = Resample_Filter(
+                filter, (min + k - center + 0.5) / filterscale
+            );
+            total += w[k];
+        }
+
+        // Rounding can leave the weights summing to a little more or less
+        // than 1.0, so the difference goes on the biggest one (else a flat
+        // area of 255 could come out as 254).
+        //
+        int16_t *out = weights + i * ksize;
+        REBINT sum = 0;
+        REBINT biggest = 0;
+        for (k = 0; k < ksize; ++k) {
+            if (k >= count or total == 0.0)
+                out[k] = 0;
+            else
+                out[k] = cast(int16_t,
+                    floor(w[k] / total * (1 << WEIGHT_BITS) + 0.5)
+                );
+            sum += out[k];
+            if (out[k] > out[biggest])
+                biggest = k;
+        }
+        if (total != 0.0)
+            out[biggest] += cast(int16_t, (1 << WEIGHT_BITS) - sum);
+
+        bounds[i * 2] = min;
+        bounds[i * 2 + 1] = count;
+    }
+
+    rebFree(w);
+
+    *bounds_out = bounds;
+    *weights_out = weights;
+    return ksize;
+}
+
+
+inline static REBYTE Clip_Weighted_Sum(int32_t sum) {
+    if (sum < 0)
+        return 0;
+    sum >>= WEIGHT_BITS;
+    return cast(REBYTE, sum > 255 ? 255 : sum);
+}
+
+
+// Resample one row of `in_w` pixels to `out_w` pixels.
+//
+static void Resample_Row(
+    REBYTE *out,
+    const REBYTE *in,
+    REBINT out_w,
+    const REBINT *bounds,
+    const int16_t *weights,
+    REBINT ksize
+){
+    REBINT i;
+    for (i = 0; i < out_w; ++i) {
+        const REBYTE *p = in + bounds[i * 2] * 4;
+        REBINT count = bounds[i * 2 + 1];
+        const int16_t *k = weights + i * ksize;
+        REBINT n;
+
+      #ifdef CPU_X86_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        __m128i sum = _mm_set1_epi32(1 << (WEIGHT_BITS - 1));
+        for (n = 0; n < count; n += 2) {
+            REBINT pair = count - n >= 2 ? 2 : 1;
+            __m128i pixels = _mm_unpacklo_epi8(
+                Load_Pixels(p + n * 4, pair), zero
+            );
+            pixels = _mm_unpacklo_epi16(pixels, _mm_srli_si128(pixels, 8));
+            __m128i kk = Weight_Pair(k[n], pair == 2 ? k[n + 1] : 0);
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(pixels, kk));
+        }
+        sum = _mm_srai_epi32(sum, WEIGHT_BITS);
+        sum = _mm_packs_epi32(sum, sum);
+        int32_t pixel = _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+        memcpy(out + i * 4, &pixel, 4);
+      #else
+        int32_t sum[4];
+        REBINT c;
+        for (c = 0; c < 4; ++c)
+            sum[c] = 1 << (WEIGHT_BITS - 1);
+        for (n = 0; n < count; ++n)
+            for (c = 0; c < 4; ++c)
+                sum[c] += k[n] * p[n * 4 + c];
+        for (c = 0; c < 4; ++c)
+            out[i * 4 + c] = Clip_Weighted_Sum(sum[c]);
+      #endif
+    }
+}
+
+
+// Resample a column of rows (`in` is the first row used, rows are `w`
+// pixels apart) into one output row.
+//
+static void Resample_Column(
+    REBYTE *out,
+    const REBYTE *in,
+    REBINT w,
+    REBINT count,
+    const int16_t *k
+){
+    REBINT stride = w * 4;
+    REBINT x = 0;
+    REBINT n;
+
+  #ifdef CPU_X86_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; x < w; x += 2) {  // 2 pixels at a time, from 2 rows at a time
+        REBINT pair = w - x >= 2 ? 2 : 1;
+        __m128i sum0 = _mm_set1_epi32(1 << (WEIGHT_BITS - 1));
+        __m128i sum1 = sum0;
+        for (n = 0; n < count; n += 2) {
+            const REBYTE *p = in + n * stride + x * 4;
+            __m128i a = Load_Pixels(p, pair);
+            __m128i b;
+            __m128i kk;
+            if (n + 1 < count) {
+                b = Load_Pixels(p + stride, pair);
+                kk = Weight_Pair(k[n], k[n + 1]);
+            }
+            else {
+                b = zero;
+                kk = Weight_Pair(k[n], 0);
+            }
+            __m128i ab = _mm_unpacklo_epi8(a, b);
+            sum0 = _mm_add_epi32(
+                sum0, _mm_madd_epi16(_mm_unpacklo_epi8(ab, zero), kk)
+            );
+            sum1 = _mm_add_epi32(
+                sum1, _mm_madd_epi16(_mm_unpackhi_epi8(ab, zero), kk)
+            );
+        }
+        __m128i sum = _mm_packs_epi32(
+            _mm_srai_epi32(sum0, WEIGHT_BITS),
+            _mm_srai_epi32(sum1, WEIGHT_BITS)
+        );
+        sum = _mm_packus_epi16(sum, sum);
+        if (pair == 2)
+            _mm_storel_epi64((__m128i*)(out + x * 4), sum);
+        else {
+            int32_t pixel = _mm_cvtsi128_si32(sum);
+            memcpy(out + x * 4, &pixel, 4);
+        }
+    }
+  #else
+    for (; x < stride; ++x) {  // each channel of each pixel
+        int32_t sum = 1 << (WEIGHT_BITS - 1);
+        for (n = 0; n < count; ++n)
+            sum += k[n] * in[n * stride + x];
+        out[x] = Clip_Weighted_Sum(sum);
+    }
+  #endif
+}
+
+
+// Output pixels per band of rows handed to Run_Tasks().  Bands this big are
+// a fraction of a millisecond of work, so starting threads for them pays.
+//
+#define RESAMPLE_BAND_PIXELS 65536
+
+// What the band tasks of one pass of Resample_RGBA() work on.  Rows of `in`
+// and `out` are `in_w` and `out_w` pixels wide.
+//
+struct Reb_Resample_Pass {
+    REBYTE *out;
+    const REBYTE *in;
+    REBINT out_w;
+    REBINT in_w;
+    REBINT rows;  // of the output (of the input for the alpha passes)
+    REBINT band_rows;
+
+    const REBINT *bounds;  // from Resample_Weights(), or the NEAREST columns
+    const int16_t *weights;
+    REBINT ksize;
+
+    REBINT in_h;  // for NEAREST, which picks rows as well as columns
+    void (*alpha)(REBYTE *rgba, REBLEN num_pixels);  // for the alpha passes
+};
+
+
+static REBINT Band_Rows(REBINT w)
+{
+    return w >= RESAMPLE_BAND_PIXELS ? 1 : RESAMPLE_BAND_PIXELS / w;
+}
+
+static REBLEN Num_Bands(const struct Reb_Resample_Pass *pass)
+{
+    return (pass->rows + pass->band_rows - 1) / pass->band_rows;
+}
+
+
+static void Resample_Nearest_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Resample_Pass *pass = cast(struct Reb_Resample_Pass*, opaque);
+    REBINT y = n * pass->band_rows;
+    REBINT end = MIN(y + pass->band_rows, pass->rows);
+    for (; y < end; ++y) {  // sample at the centers of outputs
+        REBINT sy = cast(REBINT,
+            (cast(int64_t, y) * 2 + 1) * pass->in_h
+                / (cast(int64_t, pass->rows) * 2)
+        );
+        const REBYTE *row = pass->in + sy * pass->in_w * 4;
+        REBYTE *out = pass->out + y * pass->out_w * 4;
+        REBINT x;
+        for (x = 0; x < pass->out_w; ++x)
+            memcpy(out + x * 4, row + pass->bounds[x] * 4, 4);
+    }
+}
+
+static void Resample_Row_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Resample_Pass *pass = cast(struct Reb_Resample_Pass*, opaque);
+    REBINT y = n * pass->band_rows;
+    REBINT end = MIN(y + pass->band_rows, pass->rows);
+    for (; y < end; ++y)
+        Resample_Row(
+            pass->out + y * pass->out_w * 4,
+            pass->in + y * pass->in_w * 4,
+            pass->out_w,
+            pass->bounds,
+            pass->weights,
+            pass->ksize
+        );
+}
+
+static void Resample_Column_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Resample_Pass *pass = cast(struct Reb_Resample_Pass*, opaque);
+    REBINT y = n * pass->band_rows;
+    REBINT end = MIN(y + pass->band_rows, pass->rows);
+    for (; y < end; ++y)
+        Resample_Column(
+            pass->out + y * pass->out_w * 4,
+            pass->in + pass->bounds[y * 2] * pass->out_w * 4,
+            pass->out_w,
+            pass->bounds[y * 2 + 1],
+            pass->weights + y * pass->ksize
+        );
+}
+
+static void Resample_Alpha_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Resample_Pass *pass = cast(struct Reb_Resample_Pass*, opaque);
+    REBINT y = n * pass->band_rows;
+    REBINT end = MIN(y + pass->band_rows, pass->rows);
+    (*pass->alpha)(pass->out + y * pass->out_w * 4, (end - y) * pass->out_w);
+}
+
+
+//
+//  Resample_RGBA: C
+//
+// Resize `src` to `dst`.  BILINEAR and LANCZOS work on a premultiplied copy
+// of `src` if any pixel isn't opaque.  Each pass is done in bands of rows
+// on up to TASK-THREADS threads, giving the same bytes as doing it in order.
+//
+void Resample_RGBA(
+    REBYTE *dst,
+    REBINT dst_w,
+    REBINT dst_h,
+    const REBYTE *src,
+    REBINT src_w,
+    REBINT src_h,
+    enum Reb_Resample_Filter filter
+){
+    struct Reb_Resample_Pass pass;
+
+    if (filter == RESAMPLE_NEAREST) {
+        REBINT *xs = rebAllocN(REBINT, dst_w);
+        REBINT x;
+        for (x = 0; x < dst_w; ++x)
+            xs[x] = cast(REBINT,
+                (cast(int64_t, x) * 2 + 1) * src_w / (cast(int64_t, dst_w) * 2)
+            );
+
+        pass.out = dst;
+        pass.in = src;
+        pass.out_w = dst_w;
+        pass.in_w = src_w;
+        pass.rows = dst_h;
+        pass.band_rows = Band_Rows(dst_w);
+        pass.bounds = xs;
+        pass.in_h = src_h;
+        Run_Tasks(&Resample_Nearest_Task, &pass, Num_Bands(&pass));
+
+        rebFree(xs);
+        return;
+    }
+
+    bool opaque = true;
+    REBLEN i;
+    for (i = 0; i < cast(REBLEN, src_w * src_h); ++i) {
+        if (src[i * 4 + 3] != 255) {
+            opaque = false;
+            break;
+        }
+    }
+    REBYTE *premultiplied = nullptr;
+    if (not opaque) {
+        premultiplied = rebAllocN(REBYTE, src_w * src_h * 4);
+        memcpy(premultiplied, src, src_w * src_h * 4);
+
+        pass.out = premultiplied;
+        pass.out_w = src_w;
+        pass.rows = src_h;
+        pass.band_rows = Band_Rows(src_w);
+        pass.alpha = &Premultiply_Alpha;
+        Run_Tasks(&Resample_Alpha_Task, &pass, Num_Bands(&pass));
+
+        src = premultiplied;
+    }
+
+    REBINT *bounds;
+    int16_t *weights;
+
+    // Horizontal pass, into rows of the output width
+    //
+    REBYTE *temp = rebAllocN(REBYTE, dst_w * src_h * 4);
+    REBINT ksize = Resample_Weights(&bounds, &weights, src_w, dst_w, filter);
+
+    pass.out = temp;
+    pass.in = src;
+    pass.out_w = dst_w;
+    pass.in_w = src_w;
+    pass.rows = src_h;
+    pass.band_rows = Band_Rows(dst_w);
+    pass.bounds = bounds;
+    pass.weights = weights;
+    pass.ksize = ksize;
+    Run_Tasks(&Resample_Row_Task, &pass, Num_Bands(&pass));
+
+    rebFree(bounds);
+    rebFree(weights);
+
+    // Vertical pass
+    //
+    ksize = Resample_Weights(&bounds, &weights, src_h, dst_h, filter);
+
+    pass.out = dst;
+    pass.in = temp;
+    pass.rows = dst_h;
+    pass.bounds = bounds;
+    pass.weights = weights;
+    pass.ksize = ksize;
+    Run_Tasks(&Resample_Column_Task, &pass, Num_Bands(&pass));
+
+    rebFree(bounds);
+    rebFree(weights);
+    rebFree(temp);
+
+    if (premultiplied) {
+        rebFree(premultiplied);
+
+        pass.out = dst;
+        pass.out_w = dst_w;
+        pass.rows = dst_h;
+        pass.band_rows = Band_Rows(dst_w);
+        pass.alpha = &Unpremultiply_Alpha;
+        Run_Tasks(&Resample_Alpha_Task, &pass, Num_Bands(&pass));
+    }
+}
@@ -34,8 +34,8 @@
 // has a minor dependency on %reb-c.h
 
 extern jmp_buf jpeg_state;
-extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info(char *buffer, int nbytes, int scale, int *w, int *h);
+extern void jpeg_load(char *buffer, int nbytes, int scale, char *output);
 
 
 //
@@ -60,7 +60,7 @@ REBNATIVE(identify_jpeg_q)
     REBLEN len = VAL_LEN_AT(ARG(data));
 
     int w, h;
-    jpeg_info(s_cast(data), len, &w, &h); // may longjmp above
+    jpeg_info(s_cast(data), len, 1, &w, &h); // may longjmp above
     return Init_True(D_OUT);
 }
 
@@ -72,12 +72,24 @@ REBNATIVE(identify_jpeg_q)
 //
 //      return: [image!]
 //      data [binary!]
+//      /scale "1, 2, 4 or 8 to decode at that fraction of the size"
+//          [integer!]
 //  ]
 //
 REBNATIVE(decode_jpeg)
 {
     JPG_INCLUDE_PARAMS_OF_DECODE_JPEG;
 
+    // Reducing in the IDCT skips most of the arithmetic of a full decode,
+    // so a thumbnail costs little more than the entropy decoding.
+    //
+    int scale = 1;
+    if (REF(scale)) {
+        scale = Int32(ARG(scale));
+        if (scale != 1 and scale != 2 and scale != 4 and scale != 8)
+            fail (PAR(scale));
+    }
+
     // Handle JPEG error throw:
     if (setjmp(jpeg_state))
         fail (Error_Bad_Media_Raw()); // generic
@@ -86,11 +98,11 @@ REBNATIVE(decode_jpeg)
     REBLEN len = VAL_LEN_AT(ARG(data));
 
     int w, h;
-    jpeg_info(s_cast(data), len, &w, &h); // may longjmp above
+    jpeg_info(s_cast(data), len, scale, &w, &h); // may longjmp above
 
     char *image_bytes = rebAllocN(char, (w * h) * 4);  // RGBA is 4 bytes
 
-    jpeg_load(s_cast(data), len, image_bytes);
+    jpeg_load(s_cast(data), len, scale, image_bytes);
 
     REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
 
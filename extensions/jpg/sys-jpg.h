@@ -309,7 +309,7 @@ typedef int boolean;
 #define D_PROGRESSIVE_SUPPORTED     /* Progressive JPEG? (Requires MULTISCAN)*/
 //#define SAVE_MARKERS_SUPPORTED        /* jpeg_save_markers() needed? */
 //#define BLOCK_SMOOTHING_SUPPORTED   /* Block smoothing? (Progressive only) */
-//#define IDCT_SCALING_SUPPORTED        /* Output rescaling via IDCT? */
+#define IDCT_SCALING_SUPPORTED        /* Output rescaling via IDCT? */
 //#undef  UPSAMPLE_SCALING_SUPPORTED  /* Output rescaling at upsample stage? */
 //#define UPSAMPLE_MERGING_SUPPORTED  /* Fast path for sloppy upsampling? */
 #define QUANT_1PASS_SUPPORTED       /* 1-pass color quantization? */
@@ -11,13 +11,323 @@
 #include <setjmp.h>
 
 extern jmp_buf jpeg_state;
-extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info(char *buffer, int nbytes, int scale, int *w, int *h);
+extern void jpeg_load(char *buffer, int nbytes, int scale, char *output);
 
 
 #include "pstdint.h" // for uint32_t
 
 
+// REBOL: SIMD versions of the hot loops of decoding.  The IDCT needs SSE4.1
+// (for 32-bit multiplies), so it is chosen at runtime with CPUID; color
+// conversion and upsampling only need SSE2, which every x86-64 CPU has.
+// Each gives the same samples as the IJG C code it replaces, for any data
+// whose intermediate values fit in 32 bits (which is all the data that an
+// encoder can produce; INT32 is `long`, so corrupt files could differ).
+//
+#include "sys-cpu.h"
+
+#if BITS_IN_JSAMPLE == 8 && defined(CPU_X86_DISPATCH)
+  #define JPEG_X86_SIMD
+
+LOCAL(boolean)
+jsimd_can_idct_islow (void)
+{
+  return Cpu_Has(CPU_SSE41) ? TRUE : FALSE;
+}
+
+
+#define JSIMD_MUL(v,c)  _mm_mullo_epi32((v), _mm_set1_epi32(c))
+
+// One pass of jpeg_idct_islow() on four columns (or rows) at once, the
+// eight inputs being v[0..7] and the outputs replacing them.  Constants are
+// the CONST_BITS == 13 ones of the C code.
+//
+CPU_TARGET("sse4.1")
+LOCAL(void)
+jsimd_idct_islow_pass (__m128i v[8], int shift)
+{
+  __m128i tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+  __m128i z1, z2, z3, z4, z5;
+  __m128i round = _mm_set1_epi32(1 << (shift - 1));
+  __m128i count = _mm_cvtsi32_si128(shift);
+
+  // Even part
+  z1 = JSIMD_MUL(_mm_add_epi32(v[2], v[6]), 4433);  // FIX_0_541196100
+  tmp2 = _mm_add_epi32(z1, JSIMD_MUL(v[6], -15137));  // FIX_1_847759065
+  tmp3 = _mm_add_epi32(z1, JSIMD_MUL(v[2], 6270));  // FIX_0_765366865
+  tmp0 = _mm_slli_epi32(_mm_add_epi32(v[0], v[4]), 13);
+  tmp1 = _mm_slli_epi32(_mm_sub_epi32(v[0], v[4]), 13);
+  tmp10 = _mm_add_epi32(tmp0, tmp3);
+  tmp13 = _mm_sub_epi32(tmp0, tmp3);
+  tmp11 = _mm_add_epi32(tmp1, tmp2);
+  tmp12 = _mm_sub_epi32(tmp1, tmp2);
+
+  // Odd part
+  z1 = _mm_add_epi32(v[7], v[1]);
+  z2 = _mm_add_epi32(v[5], v[3]);
+  z3 = _mm_add_epi32(v[7], v[3]);
+  z4 = _mm_add_epi32(v[5], v[1]);
+  z5 = JSIMD_MUL(_mm_add_epi32(z3, z4), 9633);  // FIX_1_175875602
+  tmp0 = JSIMD_MUL(v[7], 2446);  // FIX_0_298631336
+  tmp1 = JSIMD_MUL(v[5], 16819);  // FIX_2_053119869
+  tmp2 = JSIMD_MUL(v[3], 25172);  // FIX_3_072711026
+  tmp3 = JSIMD_MUL(v[1], 12299);  // FIX_1_501321110
+  z1 = JSIMD_MUL(z1, -7373);  // FIX_0_899976223
+  z2 = JSIMD_MUL(z2, -20995);  // FIX_2_562915447
+  z3 = _mm_add_epi32(JSIMD_MUL(z3, -16069), z5);  // FIX_1_961570560
+  z4 = _mm_add_epi32(JSIMD_MUL(z4, -3196), z5);  // FIX_0_390180644
+  tmp0 = _mm_add_epi32(tmp0, _mm_add_epi32(z1, z3));
+  tmp1 = _mm_add_epi32(tmp1, _mm_add_epi32(z2, z4));
+  tmp2 = _mm_add_epi32(tmp2, _mm_add_epi32(z2, z3));
+  tmp3 = _mm_add_epi32(tmp3, _mm_add_epi32(z1, z4));
+
+  // Final output stage, with DESCALE()
+  #define JSIMD_DESCALE(x) \
+    _mm_sra_epi32(_mm_add_epi32((x), round), count)
+  v[0] = JSIMD_DESCALE(_mm_add_epi32(tmp10, tmp3));
+  v[7] = JSIMD_DESCALE(_mm_sub_epi32(tmp10, tmp3));
+  v[1] = JSIMD_DESCALE(_mm_add_epi32(tmp11, tmp2));
+  v[6] = JSIMD_DESCALE(_mm_sub_epi32(tmp11, tmp2));
+  v[2] = JSIMD_DESCALE(_mm_add_epi32(tmp12, tmp1));
+  v[5] = JSIMD_DESCALE(_mm_sub_epi32(tmp12, tmp1));
+  v[3] = JSIMD_DESCALE(_mm_add_epi32(tmp13, tmp0));
+  v[4] = JSIMD_DESCALE(_mm_sub_epi32(tmp13, tmp0));
+  #undef JSIMD_DESCALE
+}
+
+
+// Transpose an 8x8 block of 32-bit values, where lo[r] holds columns 0..3
+// of row r and hi[r] holds columns 4..7.
+//
+CPU_TARGET("sse4.1")
+LOCAL(void)
+jsimd_transpose_8x8 (__m128i lo[8], __m128i hi[8])
+{
+  __m128i t0, t1, t2, t3;
+  int i;
+
+  #define JSIMD_TRANSPOSE_4x4(a,b,c,d) \
+    t0 = _mm_unpacklo_epi32(a, b); \
+    t1 = _mm_unpacklo_epi32(c, d); \
+    t2 = _mm_unpackhi_epi32(a, b); \
+    t3 = _mm_unpackhi_epi32(c, d); \
+    a = _mm_unpacklo_epi64(t0, t1); \
+    b = _mm_unpackhi_epi64(t0, t1); \
+    c = _mm_unpacklo_epi64(t2, t3); \
+    d = _mm_unpackhi_epi64(t2, t3);
+
+  JSIMD_TRANSPOSE_4x4(lo[0], lo[1], lo[2], lo[3]);
+  JSIMD_TRANSPOSE_4x4(hi[0], hi[1], hi[2], hi[3]);
+  JSIMD_TRANSPOSE_4x4(lo[4], lo[5], lo[6], lo[7]);
+  JSIMD_TRANSPOSE_4x4(hi[4], hi[5], hi[6], hi[7]);
+  #undef JSIMD_TRANSPOSE_4x4
+
+  for (i = 0; i < 4; i++) {  // swap the off-diagonal 4x4 blocks
+    t0 = hi[i];
+    hi[i] = lo[i + 4];
+    lo[i + 4] = t0;
+  }
+}
+
+
+// Same as jpeg_idct_islow(), but without its shortcuts for columns and rows
+// of zero AC terms (those give the same results as the general case).  The
+// final range limiting is the post-IDCT table done with arithmetic: values
+// are wrapped to RANGE_MASK as 10-bit signed numbers, then clamped.
+//
+CPU_TARGET("sse4.1")
+METHODDEF(void)
+jsimd_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+         JCOEFPTR coef_block,
+         JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  __m128i lo[DCTSIZE], hi[DCTSIZE];
+  const __m128i mask = _mm_set1_epi32(RANGE_MASK);
+  const __m128i sign = _mm_set1_epi32((RANGE_MASK + 1) / 2);
+  const __m128i center = _mm_set1_epi32(CENTERJSAMPLE);
+  int i;
+
+  for (i = 0; i < DCTSIZE; i++) {  // dequantize
+    __m128i coefs = _mm_loadu_si128((const __m128i *) (coef_block + i * 8));
+    lo[i] = _mm_mullo_epi32(
+      _mm_cvtepi16_epi32(coefs),
+      _mm_loadu_si128((const __m128i *) (quantptr + i * 8)));
+    hi[i] = _mm_mullo_epi32(
+      _mm_cvtepi16_epi32(_mm_srli_si128(coefs, 8)),
+      _mm_loadu_si128((const __m128i *) (quantptr + i * 8 + 4)));
+  }
+
+  jsimd_idct_islow_pass(lo, 13 - 2);  // CONST_BITS-PASS1_BITS
+  jsimd_idct_islow_pass(hi, 13 - 2);
+  jsimd_transpose_8x8(lo, hi);
+  jsimd_idct_islow_pass(lo, 13 + 2 + 3);  // CONST_BITS+PASS1_BITS+3
+  jsimd_idct_islow_pass(hi, 13 + 2 + 3);
+  jsimd_transpose_8x8(lo, hi);
+
+  for (i = 0; i < DCTSIZE; i++) {
+    __m128i a = _mm_and_si128(lo[i], mask);
+    __m128i b = _mm_and_si128(hi[i], mask);
+    a = _mm_add_epi32(_mm_sub_epi32(_mm_xor_si128(a, sign), sign), center);
+    b = _mm_add_epi32(_mm_sub_epi32(_mm_xor_si128(b, sign), sign), center);
+    a = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(
+      (__m128i *) (output_buf[i] + output_col), _mm_packus_epi16(a, a));
+  }
+}
+
+
+// Load 8 samples as 16-bit values.
+//
+#define JSIMD_LOAD8(p) \
+  _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (p)), zero)
+
+// Store 8 16-bit results of (x + bias) >> shift, interleaved with 8 more,
+// as 16 samples.
+//
+#define JSIMD_STORE16(p,even,odd) \
+  _mm_storeu_si128((__m128i *) (p), _mm_packus_epi16( \
+    _mm_unpacklo_epi16(even, odd), _mm_unpackhi_epi16(even, odd)))
+
+
+// The general case loop of h2v1_fancy_upsample(), 8 input columns at a time.
+// inptr is at the first column of the loop; returns how many were done.
+//
+LOCAL(JDIMENSION)
+jsimd_h2v1_fancy (JSAMPROW inptr, JSAMPROW outptr, JDIMENSION count)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i two = _mm_set1_epi16(2);
+  JDIMENSION done = 0;
+
+  for (; done + 8 <= count; done += 8, inptr += 8, outptr += 16) {
+    __m128i here = JSIMD_LOAD8(inptr);
+    __m128i three = _mm_add_epi16(_mm_add_epi16(here, here), here);
+    __m128i even = _mm_srli_epi16(_mm_add_epi16(
+      _mm_add_epi16(three, JSIMD_LOAD8(inptr - 1)), one), 2);
+    __m128i odd = _mm_srli_epi16(_mm_add_epi16(
+      _mm_add_epi16(three, JSIMD_LOAD8(inptr + 1)), two), 2);
+    JSIMD_STORE16(outptr, even, odd);
+  }
+  return done;
+}
+
+
+// The general case loop of h2v2_fancy_upsample(), 8 input columns at a time.
+// inptr0 and inptr1 are at the first column of the loop.
+//
+LOCAL(JDIMENSION)
+jsimd_h2v2_fancy (JSAMPROW inptr0, JSAMPROW inptr1, JSAMPROW outptr,
+                  JDIMENSION count)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i seven = _mm_set1_epi16(7);
+  const __m128i eight = _mm_set1_epi16(8);
+  JDIMENSION done = 0;
+
+  #define JSIMD_COLSUM(offset) _mm_add_epi16( \
+    _mm_mullo_epi16(JSIMD_LOAD8(inptr0 + (offset)), _mm_set1_epi16(3)), \
+    JSIMD_LOAD8(inptr1 + (offset)))
+
+  for (; done + 8 <= count;
+       done += 8, inptr0 += 8, inptr1 += 8, outptr += 16) {
+    __m128i thiscolsum = JSIMD_COLSUM(0);
+    __m128i three = _mm_mullo_epi16(thiscolsum, _mm_set1_epi16(3));
+    __m128i even = _mm_srli_epi16(_mm_add_epi16(
+      _mm_add_epi16(three, JSIMD_COLSUM(-1)), eight), 4);
+    __m128i odd = _mm_srli_epi16(_mm_add_epi16(
+      _mm_add_epi16(three, JSIMD_COLSUM(1)), seven), 4);
+    JSIMD_STORE16(outptr, even, odd);
+  }
+  #undef JSIMD_COLSUM
+  return done;
+}
+
+
+// Product of 8 16-bit values and a 16-bit constant, as 2 x 4 32-bit values.
+//
+#define JSIMD_MUL16(lo,hi,v,c) \
+  do { \
+    __m128i l_ = _mm_mullo_epi16((v), _mm_set1_epi16(c)); \
+    __m128i h_ = _mm_mulhi_epi16((v), _mm_set1_epi16(c)); \
+    lo = _mm_unpacklo_epi16(l_, h_); \
+    hi = _mm_unpackhi_epi16(l_, h_); \
+  } while (0)
+
+// The inner loop of ycc_rgb_convert(), 8 pixels at a time.  It computes what
+// the Cr_r_tab, Cb_b_tab, Cr_g_tab and Cb_g_tab tables hold, as the constants
+// are too big for 16 bits they are split into multiples of 65536 (a shift)
+// and the rest.  Returns how many pixels were done.
+//
+LOCAL(JDIMENSION)
+jsimd_ycc_rgb (JSAMPROW inptr0, JSAMPROW inptr1, JSAMPROW inptr2,
+               JSAMPROW outptr, JDIMENSION num_cols)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  const __m128i half = _mm_set1_epi32(32768);  // ONE_HALF
+  JDIMENSION col = 0;
+  JSAMPLE r[8], g[8], b[8];
+  int i;
+
+  for (; col + 8 <= num_cols; col += 8) {
+    __m128i y = JSIMD_LOAD8(inptr0 + col);
+    __m128i cb = _mm_sub_epi16(JSIMD_LOAD8(inptr1 + col), center);
+    __m128i cr = _mm_sub_epi16(JSIMD_LOAD8(inptr2 + col), center);
+    __m128i y_lo = _mm_unpacklo_epi16(y, zero);
+    __m128i y_hi = _mm_unpackhi_epi16(y, zero);
+    __m128i cb_lo = _mm_unpacklo_epi16(zero, cb);  // cb << 16
+    __m128i cb_hi = _mm_unpackhi_epi16(zero, cb);
+    __m128i cr_lo = _mm_unpacklo_epi16(zero, cr);  // cr << 16
+    __m128i cr_hi = _mm_unpackhi_epi16(zero, cr);
+    __m128i lo, hi, lo2, hi2, out;
+
+    // R = y + ((91881 * cr + ONE_HALF) >> 16), 91881 = 65536 + 26345
+    JSIMD_MUL16(lo, hi, cr, 26345);
+    lo = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(lo, cr_lo), half), 16);
+    hi = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(hi, cr_hi), half), 16);
+    out = _mm_packs_epi32(_mm_add_epi32(lo, y_lo), _mm_add_epi32(hi, y_hi));
+    _mm_storel_epi64((__m128i *) r, _mm_packus_epi16(out, out));
+
+    // G = y + ((-22554 * cb - 46802 * cr + ONE_HALF) >> 16),
+    // -46802 = 18734 - 65536
+    JSIMD_MUL16(lo, hi, cb, -22554);
+    JSIMD_MUL16(lo2, hi2, cr, 18734);
+    lo = _mm_add_epi32(_mm_add_epi32(lo, lo2), half);
+    hi = _mm_add_epi32(_mm_add_epi32(hi, hi2), half);
+    lo = _mm_srai_epi32(_mm_sub_epi32(lo, cr_lo), 16);
+    hi = _mm_srai_epi32(_mm_sub_epi32(hi, cr_hi), 16);
+    out = _mm_packs_epi32(_mm_add_epi32(lo, y_lo), _mm_add_epi32(hi, y_hi));
+    _mm_storel_epi64((__m128i *) g, _mm_packus_epi16(out, out));
+
+    // B = y + ((116130 * cb + ONE_HALF) >> 16), 116130 = 131072 - 14942
+    JSIMD_MUL16(lo, hi, cb, -14942);
+    lo = _mm_add_epi32(_mm_add_epi32(lo, _mm_slli_epi32(cb_lo, 1)), half);
+    hi = _mm_add_epi32(_mm_add_epi32(hi, _mm_slli_epi32(cb_hi, 1)), half);
+    lo = _mm_srai_epi32(lo, 16);
+    hi = _mm_srai_epi32(hi, 16);
+    out = _mm_packs_epi32(_mm_add_epi32(lo, y_lo), _mm_add_epi32(hi, y_hi));
+    _mm_storel_epi64((__m128i *) b, _mm_packus_epi16(out, out));
+
+    for (i = 0; i < 8; i++) {
+      outptr[RGB_RED] = r[i];
+      outptr[RGB_GREEN] = g[i];
+      outptr[RGB_BLUE] = b[i];
+      outptr += RGB_PIXELSIZE;
+    }
+  }
+  return col;
+}
+
+#undef JSIMD_MUL16
+#undef JSIMD_LOAD8
+#undef JSIMD_STORE16
+
+#endif  // JPEG_X86_SIMD
+
+
 /*
  * jdatasrc.c
  *
@@ -221,7 +531,11 @@ jpeg_series_src (j_decompress_ptr cinfo, JOCTET *buffer, size_t nbytes )
   src->pub.next_input_byte = NULL; /* until buffer loaded */
 }
 
-void jpeg_info( char *buffer, int nbytes, int *w, int *h )
+// REBOL: `scale` is 1, 2, 4 or 8, and reduces the output size by that factor
+// in the IDCT (which is faster than decoding at full size and resampling).
+// The width and height round up, as jpeg_calc_output_dimensions() does.
+//
+void jpeg_info( char *buffer, int nbytes, int scale, int *w, int *h )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
@@ -235,18 +549,22 @@ void jpeg_info( char *buffer, int nbytes, int *w, int *h )
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
-  *w = cinfo.image_width;
-  *h = cinfo.image_height;
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
+  jpeg_calc_output_dimensions(&cinfo);
+  *w = cinfo.output_width;
+  *h = cinfo.output_height;
 
   jpeg_destroy_decompress(&cinfo);
 }
 
-void jpeg_load( char *buffer, int nbytes, char *output )
+void jpeg_load( char *buffer, int nbytes, int scale, char *output )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
   JSAMPROW  array[ 4 ];
   unsigned int  i, j;
+  JDIMENSION  width;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
@@ -257,29 +575,32 @@ void jpeg_load( char *buffer, int nbytes, char *output )
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
 
   /* Start decompressor */
   (void) jpeg_start_decompress(&cinfo);
+  width = cinfo.output_width;
 
   /* Process data */
   while (cinfo.output_scanline < cinfo.output_height) {
-    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * cinfo.image_width * 4);
-    array[ 1 ] = array[ 0 ] + cinfo.image_width * 4;
-    array[ 2 ] = array[ 1 ] + cinfo.image_width * 4;
-    array[ 3 ] = array[ 2 ] + cinfo.image_width * 4;
+    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * width * 4);
+    array[ 1 ] = array[ 0 ] + width * 4;
+    array[ 2 ] = array[ 1 ] + width * 4;
+    array[ 3 ] = array[ 2 ] + width * 4;
     jpeg_read_scanlines(&cinfo, array, 4 );
   }
 
   if (cinfo.out_color_space != JCS_GRAYSCALE)
   // convert 3 byte values into four byte ones
-  for ( i=0; i<cinfo.image_height; i++ ) {
+  for ( i=0; i<cinfo.output_height; i++ ) {
     unsigned char   *cp;
     unsigned char   *dp;
 
-    cp = (unsigned char *)(output + cinfo.image_width * 3);
-    dp = (unsigned char *)(output + cinfo.image_width * 4);
+    cp = (unsigned char *)(output + width * 3);
+    dp = (unsigned char *)(output + width * 4);
     output = ( char * )dp;
-    for ( j=0; j<cinfo.image_width; j++ ) {
+    for ( j=0; j<width; j++ ) {
         cp -= 3;
         *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
         *--dp = cp[2]; // blue
@@ -289,15 +610,15 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   }
   else
   // convert 1 byte value into four byte ones
-    for ( i=0; i<cinfo.image_height; i++ ) {
+    for ( i=0; i<cinfo.output_height; i++ ) {
       unsigned char *cp;
       unsigned char *dp;
       unsigned char c;
 
-      cp = (unsigned char *)(output + cinfo.image_width);
-      dp = (unsigned char *)(output + cinfo.image_width * 4);
+      cp = (unsigned char *)(output + width);
+      dp = (unsigned char *)(output + width * 4);
       output = ( char * )dp;
-      for ( j=0; j<cinfo.image_width; j++ ) {
+      for ( j=0; j<width; j++ ) {
         c = *--cp;
         *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
         *--dp = c; // blue
@@ -5590,6 +5911,10 @@ start_pass (j_decompress_ptr cinfo)
 #ifdef DCT_ISLOW_SUPPORTED
       case JDCT_ISLOW:
     method_ptr = jpeg_idct_islow;
+  #ifdef JPEG_X86_SIMD
+    if (jsimd_can_idct_islow())
+      method_ptr = jsimd_idct_islow;
+  #endif
     method = JDCT_ISLOW;
     break;
 #endif
@@ -6741,6 +7066,410 @@ jpeg_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
 }
 
 #endif /* DCT_ISLOW_SUPPORTED */
+/*
+ * jidctred.c
+ *
+ * Copyright (C) 1994-1998, Thomas G. Lane.
+ * This file is part of the Independent JPEG Group's software.
+ * For conditions of distribution and use, see the accompanying README file.
+ *
+ * This file contains inverse-DCT routines that produce reduced-size output:
+ * either 4x4, 2x2, or 1x1 pixels from an 8x8 DCT block.
+ *
+ * The implementation is based on the Loeffler, Ligtenberg and Moschytz (LL&M)
+ * algorithm used in jidctint.c.  We simply replace each 8-to-8 1-D IDCT step
+ * with an 8-to-4 step that produces the four averages of two adjacent outputs
+ * (or an 8-to-2 step producing two averages of four outputs, for 2x2 output).
+ * These steps were derived by computing the corresponding values at the end
+ * of the normal LL&M code, then simplifying as much as possible.
+ *
+ * 1x1 is trivial: just take the DC coefficient divided by 8.
+ *
+ * See jidctint.c for additional comments.
+ */
+
+#define JPEG_INTERNALS
+//#include "jinclude.h"
+//#include "jpeglib.h"
+//#include "jdct.h"     /* Private declarations for DCT subsystem */
+
+#ifdef IDCT_SCALING_SUPPORTED
+
+
+/*
+ * This module is specialized to the case DCTSIZE = 8.
+ */
+
+#if DCTSIZE != 8
+  Sorry, this code only copes with 8x8 DCTs. /* deliberate syntax err */
+#endif
+
+
+/* Scaling is the same as in jidctint.c. */
+
+#undef CONST_BITS
+#undef PASS1_BITS
+#if BITS_IN_JSAMPLE == 8
+#define CONST_BITS  13
+#define PASS1_BITS  2
+#else
+#define CONST_BITS  13
+#define PASS1_BITS  1       /* lose a little precision to avoid overflow */
+#endif
+
+/* Some C compilers fail to reduce "FIX(constant)" at compile time, thus
+ * causing a lot of useless floating-point operations at run time.
+ * To get around this we use the following pre-calculated constants.
+ * If you change CONST_BITS you may want to add appropriate values.
+ * (With a reasonable C compiler, you can just rely on the FIX() macro...)
+ */
+
+#undef FIX_0_765366865
+#undef FIX_0_899976223
+#undef FIX_1_847759065
+#undef FIX_2_562915447
+#if CONST_BITS == 13
+#define FIX_0_211164243  ((INT32)  1730)    /* FIX(0.211164243) */
+#define FIX_0_509795579  ((INT32)  4176)    /* FIX(0.509795579) */
+#define FIX_0_601344887  ((INT32)  4926)    /* FIX(0.601344887) */
+#define FIX_0_720959822  ((INT32)  5906)    /* FIX(0.720959822) */
+#define FIX_0_765366865  ((INT32)  6270)    /* FIX(0.765366865) */
+#define FIX_0_850430095  ((INT32)  6967)    /* FIX(0.850430095) */
+#define FIX_0_899976223  ((INT32)  7373)    /* FIX(0.899976223) */
+#define FIX_1_061594337  ((INT32)  8697)    /* FIX(1.061594337) */
+#define FIX_1_272758580  ((INT32)  10426)   /* FIX(1.272758580) */
+#define FIX_1_451774981  ((INT32)  11893)   /* FIX(1.451774981) */
+#define FIX_1_847759065  ((INT32)  15137)   /* FIX(1.847759065) */
+#define FIX_2_172734803  ((INT32)  17799)   /* FIX(2.172734803) */
+#define FIX_2_562915447  ((INT32)  20995)   /* FIX(2.562915447) */
+#define FIX_3_624509785  ((INT32)  29692)   /* FIX(3.624509785) */
+#else
+#define FIX_0_211164243  FIX(0.211164243)
+#define FIX_0_509795579  FIX(0.509795579)
+#define FIX_0_601344887  FIX(0.601344887)
+#define FIX_0_720959822  FIX(0.720959822)
+#define FIX_0_765366865  FIX(0.765366865)
+#define FIX_0_850430095  FIX(0.850430095)
+#define FIX_0_899976223  FIX(0.899976223)
+#define FIX_1_061594337  FIX(1.061594337)
+#define FIX_1_272758580  FIX(1.272758580)
+#define FIX_1_451774981  FIX(1.451774981)
+#define FIX_1_847759065  FIX(1.847759065)
+#define FIX_2_172734803  FIX(2.172734803)
+#define FIX_2_562915447  FIX(2.562915447)
+#define FIX_3_624509785  FIX(3.624509785)
+#endif
+
+
+/* Multiply an INT32 variable by an INT32 constant to yield an INT32 result.
+ * For 8-bit samples with the recommended scaling, all the variable
+ * and constant values involved are no more than 16 bits wide, so a
+ * 16x16->32 bit multiply can be used instead of a full 32x32 multiply.
+ * For 12-bit samples, a full 32-bit multiplication will be needed.
+ */
+
+#if BITS_IN_JSAMPLE == 8
+#define jidr_MULTIPLY(var,const)  MULTIPLY16C16(var,const)
+#else
+#define jidr_MULTIPLY(var,const)  ((var) * (const))
+#endif
+
+
+/* Dequantize a coefficient by multiplying it by the multiplier-table
+ * entry; produce an int result.  In this module, both inputs and result
+ * are 16 bits or less, so either int or short multiply will work.
+ */
+
+#define jidr_DEQUANTIZE(coef,quantval)  (((ISLOW_MULT_TYPE) (coef)) * (quantval))
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 4x4 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_4x4 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  INT32 tmp0, tmp2, tmp10, tmp12;
+  INT32 z1, z2, z3, z4;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  JSAMPROW outptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  int ctr;
+  int workspace[DCTSIZE*4]; /* buffers data between passes */
+  SHIFT_TEMPS
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  inptr = coef_block;
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  wsptr = workspace;
+  for (ctr = DCTSIZE; ctr > 0; inptr++, quantptr++, wsptr++, ctr--) {
+    /* Don't bother to process column 4, because second pass won't use it */
+    if (ctr == DCTSIZE-4)
+      continue;
+    if (inptr[DCTSIZE*1] == 0 && inptr[DCTSIZE*2] == 0 &&
+    inptr[DCTSIZE*3] == 0 && inptr[DCTSIZE*5] == 0 &&
+    inptr[DCTSIZE*6] == 0 && inptr[DCTSIZE*7] == 0) {
+      /* AC terms all zero; we need not examine term 4 for 4x4 output */
+      int dcval = jidr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]) << PASS1_BITS;
+
+      wsptr[DCTSIZE*0] = dcval;
+      wsptr[DCTSIZE*1] = dcval;
+      wsptr[DCTSIZE*2] = dcval;
+      wsptr[DCTSIZE*3] = dcval;
+
+      continue;
+    }
+
+    /* Even part */
+
+    tmp0 = jidr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]);
+    tmp0 <<= (CONST_BITS+1);
+
+    z2 = jidr_DEQUANTIZE(inptr[DCTSIZE*2], quantptr[DCTSIZE*2]);
+    z3 = jidr_DEQUANTIZE(inptr[DCTSIZE*6], quantptr[DCTSIZE*6]);
+
+    tmp2 = jidr_MULTIPLY(z2, FIX_1_847759065) + jidr_MULTIPLY(z3, - FIX_0_765366865);
+
+    tmp10 = tmp0 + tmp2;
+    tmp12 = tmp0 - tmp2;
+
+    /* Odd part */
+
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*7], quantptr[DCTSIZE*7]);
+    z2 = jidr_DEQUANTIZE(inptr[DCTSIZE*5], quantptr[DCTSIZE*5]);
+    z3 = jidr_DEQUANTIZE(inptr[DCTSIZE*3], quantptr[DCTSIZE*3]);
+    z4 = jidr_DEQUANTIZE(inptr[DCTSIZE*1], quantptr[DCTSIZE*1]);
+
+    tmp0 = jidr_MULTIPLY(z1, - FIX_0_211164243) /* sqrt(2) * (c3-c1) */
+     + jidr_MULTIPLY(z2, FIX_1_451774981) /* sqrt(2) * (c3+c7) */
+     + jidr_MULTIPLY(z3, - FIX_2_172734803) /* sqrt(2) * (-c1-c5) */
+     + jidr_MULTIPLY(z4, FIX_1_061594337); /* sqrt(2) * (c5+c7) */
+
+    tmp2 = jidr_MULTIPLY(z1, - FIX_0_509795579) /* sqrt(2) * (c7-c5) */
+     + jidr_MULTIPLY(z2, - FIX_0_601344887) /* sqrt(2) * (c5-c1) */
+     + jidr_MULTIPLY(z3, FIX_0_899976223) /* sqrt(2) * (c3+c7) */
+     + jidr_MULTIPLY(z4, FIX_2_562915447); /* sqrt(2) * (c1+c3) */
+
+    /* Final output stage */
+
+    wsptr[DCTSIZE*0] = (int) DESCALE(tmp10 + tmp2, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*3] = (int) DESCALE(tmp10 - tmp2, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*1] = (int) DESCALE(tmp12 + tmp0, CONST_BITS-PASS1_BITS+1);
+    wsptr[DCTSIZE*2] = (int) DESCALE(tmp12 - tmp0, CONST_BITS-PASS1_BITS+1);
+  }
+
+  /* Pass 2: process 4 rows from work array, store into output array. */
+
+  wsptr = workspace;
+  for (ctr = 0; ctr < 4; ctr++) {
+    outptr = output_buf[ctr] + output_col;
+    /* It's not clear whether a zero row test is worthwhile here ... */
+
+#ifndef NO_ZERO_ROW_TEST
+    if (wsptr[1] == 0 && wsptr[2] == 0 && wsptr[3] == 0 &&
+    wsptr[5] == 0 && wsptr[6] == 0 && wsptr[7] == 0) {
+      /* AC terms all zero */
+      JSAMPLE dcval = range_limit[(int) DESCALE((INT32) wsptr[0], PASS1_BITS+3)
+                  & RANGE_MASK];
+
+      outptr[0] = dcval;
+      outptr[1] = dcval;
+      outptr[2] = dcval;
+      outptr[3] = dcval;
+
+      wsptr += DCTSIZE;     /* advance pointer to next row */
+      continue;
+    }
+#endif
+
+    /* Even part */
+
+    tmp0 = ((INT32) wsptr[0]) << (CONST_BITS+1);
+
+    tmp2 = jidr_MULTIPLY((INT32) wsptr[2], FIX_1_847759065)
+     + jidr_MULTIPLY((INT32) wsptr[6], - FIX_0_765366865);
+
+    tmp10 = tmp0 + tmp2;
+    tmp12 = tmp0 - tmp2;
+
+    /* Odd part */
+
+    z1 = (INT32) wsptr[7];
+    z2 = (INT32) wsptr[5];
+    z3 = (INT32) wsptr[3];
+    z4 = (INT32) wsptr[1];
+
+    tmp0 = jidr_MULTIPLY(z1, - FIX_0_211164243) /* sqrt(2) * (c3-c1) */
+     + jidr_MULTIPLY(z2, FIX_1_451774981) /* sqrt(2) * (c3+c7) */
+     + jidr_MULTIPLY(z3, - FIX_2_172734803) /* sqrt(2) * (-c1-c5) */
+     + jidr_MULTIPLY(z4, FIX_1_061594337); /* sqrt(2) * (c5+c7) */
+
+    tmp2 = jidr_MULTIPLY(z1, - FIX_0_509795579) /* sqrt(2) * (c7-c5) */
+     + jidr_MULTIPLY(z2, - FIX_0_601344887) /* sqrt(2) * (c5-c1) */
+     + jidr_MULTIPLY(z3, FIX_0_899976223) /* sqrt(2) * (c3+c7) */
+     + jidr_MULTIPLY(z4, FIX_2_562915447); /* sqrt(2) * (c1+c3) */
+
+    /* Final output stage */
+
+    outptr[0] = range_limit[(int) DESCALE(tmp10 + tmp2,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[3] = range_limit[(int) DESCALE(tmp10 - tmp2,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[1] = range_limit[(int) DESCALE(tmp12 + tmp0,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+    outptr[2] = range_limit[(int) DESCALE(tmp12 - tmp0,
+                      CONST_BITS+PASS1_BITS+3+1)
+                & RANGE_MASK];
+
+    wsptr += DCTSIZE;       /* advance pointer to next row */
+  }
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 2x2 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_2x2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  INT32 tmp0, tmp10, z1;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  JSAMPROW outptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  int ctr;
+  int workspace[DCTSIZE*2]; /* buffers data between passes */
+  SHIFT_TEMPS
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  inptr = coef_block;
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  wsptr = workspace;
+  for (ctr = DCTSIZE; ctr > 0; inptr++, quantptr++, wsptr++, ctr--) {
+    /* Don't bother to process columns 2,4,6 */
+    if (ctr == DCTSIZE-2 || ctr == DCTSIZE-4 || ctr == DCTSIZE-6)
+      continue;
+    if (inptr[DCTSIZE*1] == 0 && inptr[DCTSIZE*3] == 0 &&
+    inptr[DCTSIZE*5] == 0 && inptr[DCTSIZE*7] == 0) {
+      /* AC terms all zero; we need not examine terms 2,4,6 for 2x2 output */
+      int dcval = jidr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]) << PASS1_BITS;
+
+      wsptr[DCTSIZE*0] = dcval;
+      wsptr[DCTSIZE*1] = dcval;
+
+      continue;
+    }
+
+    /* Even part */
+
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*0], quantptr[DCTSIZE*0]);
+    tmp10 = z1 << (CONST_BITS+2);
+
+    /* Odd part */
+
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*7], quantptr[DCTSIZE*7]);
+    tmp0 = jidr_MULTIPLY(z1, - FIX_0_720959822); /* sqrt(2) * (c7-c5+c3-c1) */
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*5], quantptr[DCTSIZE*5]);
+    tmp0 += jidr_MULTIPLY(z1, FIX_0_850430095); /* sqrt(2) * (-c1+c3+c5+c7) */
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*3], quantptr[DCTSIZE*3]);
+    tmp0 += jidr_MULTIPLY(z1, - FIX_1_272758580); /* sqrt(2) * (-c1+c3-c5-c7) */
+    z1 = jidr_DEQUANTIZE(inptr[DCTSIZE*1], quantptr[DCTSIZE*1]);
+    tmp0 += jidr_MULTIPLY(z1, FIX_3_624509785); /* sqrt(2) * (c1+c3+c5+c7) */
+
+    /* Final output stage */
+
+    wsptr[DCTSIZE*0] = (int) DESCALE(tmp10 + tmp0, CONST_BITS-PASS1_BITS+2);
+    wsptr[DCTSIZE*1] = (int) DESCALE(tmp10 - tmp0, CONST_BITS-PASS1_BITS+2);
+  }
+
+  /* Pass 2: process 2 rows from work array, store into output array. */
+
+  wsptr = workspace;
+  for (ctr = 0; ctr < 2; ctr++) {
+    outptr = output_buf[ctr] + output_col;
+    /* It's not clear whether a zero row test is worthwhile here ... */
+
+#ifndef NO_ZERO_ROW_TEST
+    if (wsptr[1] == 0 && wsptr[3] == 0 && wsptr[5] == 0 && wsptr[7] == 0) {
+      /* AC terms all zero */
+      JSAMPLE dcval = range_limit[(int) DESCALE((INT32) wsptr[0], PASS1_BITS+3)
+                  & RANGE_MASK];
+
+      outptr[0] = dcval;
+      outptr[1] = dcval;
+
+      wsptr += DCTSIZE;     /* advance pointer to next row */
+      continue;
+    }
+#endif
+
+    /* Even part */
+
+    tmp10 = ((INT32) wsptr[0]) << (CONST_BITS+2);
+
+    /* Odd part */
+
+    tmp0 = jidr_MULTIPLY((INT32) wsptr[7], - FIX_0_720959822) /* sqrt(2) * (c7-c5+c3-c1) */
+     + jidr_MULTIPLY((INT32) wsptr[5], FIX_0_850430095) /* sqrt(2) * (-c1+c3+c5+c7) */
+     + jidr_MULTIPLY((INT32) wsptr[3], - FIX_1_272758580) /* sqrt(2) * (-c1+c3-c5-c7) */
+     + jidr_MULTIPLY((INT32) wsptr[1], FIX_3_624509785); /* sqrt(2) * (c1+c3+c5+c7) */
+
+    /* Final output stage */
+
+    outptr[0] = range_limit[(int) DESCALE(tmp10 + tmp0,
+                      CONST_BITS+PASS1_BITS+3+2)
+                & RANGE_MASK];
+    outptr[1] = range_limit[(int) DESCALE(tmp10 - tmp0,
+                      CONST_BITS+PASS1_BITS+3+2)
+                & RANGE_MASK];
+
+    wsptr += DCTSIZE;       /* advance pointer to next row */
+  }
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a reduced-size 1x1 output block.
+ */
+
+GLOBAL(void)
+jpeg_idct_1x1 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  int dcval;
+  ISLOW_MULT_TYPE * quantptr;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  SHIFT_TEMPS
+
+  /* We hardly need an inverse DCT routine for this: just take the
+   * average pixel value, which is one-eighth of the DC coefficient.
+   */
+  quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  dcval = jidr_DEQUANTIZE(coef_block[0], quantptr[0]);
+  dcval = (int) DESCALE((INT32) dcval, 3);
+
+  output_buf[0][output_col] = range_limit[dcval & RANGE_MASK];
+}
+
+#endif /* IDCT_SCALING_SUPPORTED */
 /*
  * jdsample.c
  *
@@ -7061,7 +7790,16 @@ h2v1_fancy_upsample (j_decompress_ptr cinfo, jpeg_component_info * compptr,
     *outptr++ = (JSAMPLE) invalue;
     *outptr++ = (JSAMPLE) ((invalue * 3 + GETJSAMPLE(*inptr) + 2) >> 2);
 
-    for (colctr = compptr->downsampled_width - 2; colctr > 0; colctr--) {
+    colctr = compptr->downsampled_width - 2;
+#ifdef JPEG_X86_SIMD
+    {
+      JDIMENSION done = jsimd_h2v1_fancy(inptr, outptr, colctr);
+      inptr += done;
+      outptr += 2 * done;
+      colctr -= done;
+    }
+#endif
+    for (; colctr > 0; colctr--) {
       /* General case: 3/4 * nearer pixel + 1/4 * further pixel */
       invalue = GETJSAMPLE(*inptr++) * 3;
       *outptr++ = (JSAMPLE) ((invalue + GETJSAMPLE(inptr[-2]) + 1) >> 2);
@@ -7116,7 +7854,22 @@ h2v2_fancy_upsample (j_decompress_ptr cinfo, jpeg_component_info * compptr,
       *outptr++ = (JSAMPLE) ((thiscolsum * 3 + nextcolsum + 7) >> 4);
       lastcolsum = thiscolsum; thiscolsum = nextcolsum;
 
-      for (colctr = compptr->downsampled_width - 2; colctr > 0; colctr--) {
+      colctr = compptr->downsampled_width - 2;
+#ifdef JPEG_X86_SIMD
+      {
+    JDIMENSION done = jsimd_h2v2_fancy(
+      inptr0 - 1, inptr1 - 1, outptr, colctr);
+    if (done > 0) {
+      inptr0 += done;
+      inptr1 += done;
+      outptr += 2 * done;
+      colctr -= done;
+      lastcolsum = GETJSAMPLE(inptr0[-2]) * 3 + GETJSAMPLE(inptr1[-2]);
+      thiscolsum = GETJSAMPLE(inptr0[-1]) * 3 + GETJSAMPLE(inptr1[-1]);
+    }
+      }
+#endif
+      for (; colctr > 0; colctr--) {
     /* General case: 3/4 * nearer pixel + 1/4 * further pixel in each */
     /* dimension, thus 9/16, 3/16, 3/16, 1/16 overall */
     nextcolsum = GETJSAMPLE(*inptr0++) * 3 + GETJSAMPLE(*inptr1++);
@@ -7362,7 +8115,12 @@ ycc_rgb_convert (j_decompress_ptr cinfo,
     inptr2 = input_buf[2][input_row];
     input_row++;
     outptr = *output_buf++;
-    for (col = 0; col < num_cols; col++) {
+    col = 0;
+#ifdef JPEG_X86_SIMD
+    col = jsimd_ycc_rgb(inptr0, inptr1, inptr2, outptr, num_cols);
+    outptr += col * RGB_PIXELSIZE;
+#endif
+    for (; col < num_cols; col++) {
       y  = GETJSAMPLE(inptr0[col]);
       cb = GETJSAMPLE(inptr1[col]);
       cr = GETJSAMPLE(inptr2[col]);
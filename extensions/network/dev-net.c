@@ -39,6 +39,14 @@
 
 #include "reb-net.h"
 
+#if defined(TO_LINUX) || defined(TO_ANDROID)
+    #include <sys/sendfile.h>
+#endif
+#ifndef TO_WINDOWS
+    #include <sys/stat.h>
+    #include <sys/uio.h>  // struct iovec, for sendmsg()
+#endif
+
 #if (0)
     #define WATCH1(s,a) printf(s, a)
     #define WATCH2(s,a,b) printf(s, a, b)
@@ -116,6 +124,165 @@ static bool Set_Sock_Options(SOCKET sock)
 }
 
 
+// A WRITE of a BLOCK! sends its BINARY! and TEXT! pieces with one gathering
+// call, picking up past the bytes that earlier calls got out.  At most this
+// many pieces are offered at once; the device is called again for the rest.
+//
+#define MAX_GATHER 64
+
+static int Send_Gathered(
+    REBREQ *sock,
+    const REBVAL *block,
+    struct sockaddr_in *remote_addr
+){
+    struct rebol_devreq *req = Req(sock);
+
+  #ifdef TO_WINDOWS
+    WSABUF bufs[MAX_GATHER];
+  #else
+    struct iovec bufs[MAX_GATHER];
+  #endif
+    int n = 0;
+
+    REBLEN skip = req->actual;  // bytes of leading pieces already sent
+    RELVAL *item = VAL_ARRAY_AT(block);
+    for (; NOT_END(item) and n < MAX_GATHER; ++item) {
+        REBSIZ size;
+        const REBYTE *bp = VAL_BYTES_AT(&size, item);
+        if (skip >= size) {
+            skip -= size;
+            continue;
+        }
+
+      #ifdef TO_WINDOWS
+        bufs[n].buf = m_cast(char*, s_cast(bp + skip));
+        bufs[n].len = size - skip;
+      #else
+        bufs[n].iov_base = m_cast(REBYTE*, bp + skip);
+        bufs[n].iov_len = size - skip;
+      #endif
+        ++n;
+        skip = 0;
+    }
+
+    bool udp = did (req->modes & RST_UDP);
+
+  #ifdef TO_WINDOWS
+    DWORD sent;
+    if (SOCKET_ERROR == WSASendTo(
+        req->requestee.socket, bufs, n, &sent, 0,
+        udp ? cast(struct sockaddr*, remote_addr) : nullptr,
+        udp ? sizeof(*remote_addr) : 0,
+        nullptr, nullptr
+    )){
+        return -1;
+    }
+    return sent;
+  #else
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    if (udp) {
+        msg.msg_name = remote_addr;
+        msg.msg_namelen = sizeof(*remote_addr);
+    }
+    msg.msg_iov = bufs;
+    msg.msg_iovlen = n;
+
+    return sendmsg(req->requestee.socket, &msg, MSG_NOSIGNAL);
+  #endif
+}
+
+
+// SEND-FILE writes from the OS position of a file port's handle, leaving the
+// position after what was sent.  Linux has sendfile() to do that without
+// the data passing through user space.  Elsewhere the file is read a chunk
+// at a time onto the C stack (still never entering the interpreter's heap)
+// and the position is backed up by however much the send didn't take.
+//
+// Like send(), this returns -1 with the error in GET_ERROR if the read fails,
+// so Transfer_Socket() reports it the way it does for the socket.
+//
+static int Send_File(REBREQ *sock, const REBVAL *file_port, size_t len)
+{
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(file_port), STD_PORT_STATE);
+    struct rebol_devreq *file = Req(VAL_BINARY(state));
+    SOCKET s = Req(sock)->requestee.socket;
+
+  #if defined(TO_LINUX) || defined(TO_ANDROID)
+    return sendfile(s, file->requestee.id, nullptr, len);
+  #else
+    char buf[MAX_TRANSFER];
+    if (len > MAX_TRANSFER)
+        len = MAX_TRANSFER;
+
+    #ifdef TO_WINDOWS
+      HANDLE h = cast(HANDLE, file->requestee.handle);
+      DWORD got;
+      if (not ReadFile(h, buf, len, &got, nullptr)) {
+          WSASetLastError(GetLastError());
+          return -1;
+      }
+    #else
+      ssize_t got = read(file->requestee.id, buf, len);
+      if (got < 0)
+          return -1;  // errno is GET_ERROR
+    #endif
+
+    if (got == 0)
+        return 0;  // end of file
+
+    int sent = send(s, buf, got, MSG_NOSIGNAL);
+    int unsent = got - (sent < 0 ? 0 : sent);
+    if (unsent != 0) {
+      #ifdef TO_WINDOWS
+        int err = WSAGetLastError();  // SetFilePointerEx() could clobber
+        LARGE_INTEGER back;
+        back.QuadPart = -unsent;
+        SetFilePointerEx(h, back, nullptr, FILE_CURRENT);
+        WSASetLastError(err);
+      #else
+        int err = errno;  // lseek() could clobber
+        lseek(file->requestee.id, -unsent, SEEK_CUR);
+        errno = err;
+      #endif
+    }
+    return sent;
+  #endif
+}
+
+
+//
+//  Get_File_Remaining: C
+//
+// Number of bytes from the OS position of an open file port's handle to the
+// end of the file (the amount SEND-FILE will send if not given a /PART).
+//
+int64_t Get_File_Remaining(REBREQ *file)
+{
+  #ifdef TO_WINDOWS
+    HANDLE h = cast(HANDLE, Req(file)->requestee.handle);
+    LARGE_INTEGER zero;
+    zero.QuadPart = 0;
+    LARGE_INTEGER pos;
+    LARGE_INTEGER size;
+    if (
+        not SetFilePointerEx(h, zero, &pos, FILE_CURRENT)
+        or not GetFileSizeEx(h, &size)
+    ){
+        rebFail_OS (GetLastError());
+    }
+    return size.QuadPart > pos.QuadPart ? size.QuadPart - pos.QuadPart : 0;
+  #else
+    int h = Req(file)->requestee.id;
+    struct stat info;
+    off_t pos = lseek(h, 0, SEEK_CUR);
+    if (pos < 0 or fstat(h, &info) != 0)
+        rebFail_OS (errno);
+    return info.st_size > pos ? info.st_size - pos : 0;
+  #endif
+}
+
+
 //
 //  Init_Net: C
 //
@@ -443,16 +610,42 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
             ReqNet(sock)->remote_ip,
             ReqNet(sock)->remote_port
         );
-        result = sendto(
-            req->requestee.socket,
-            s_cast(req->common.data), len,
-            MSG_NOSIGNAL, // Flags
-            cast(struct sockaddr*, &remote_addr), addr_len
-        );
+
+        // A BLOCK! or PORT! (from SEND-FILE) is held in the port data, and
+        // the device finds its place in them with req->actual.  Other writes
+        // advance req->common.data through the bytes of a BINARY! or TEXT!.
+        //
+        const REBVAL *pending = req->common.binary;
+        if (IS_BLOCK(pending))
+            result = Send_Gathered(sock, pending, &remote_addr);
+        else if (IS_PORT(pending)) {
+            result = Send_File(sock, pending, req->length - req->actual);
+            if (result == 0 and req->actual < req->length) {
+                //
+                // The file ended before the length SEND-FILE was given.
+                // Report that as an I/O error through GET_ERROR below.
+                //
+              #ifdef TO_WINDOWS
+                WSASetLastError(ERROR_HANDLE_EOF);
+              #else
+                errno = EIO;
+              #endif
+                result = -1;
+            }
+        }
+        else {
+            result = sendto(
+                req->requestee.socket,
+                s_cast(req->common.data), len,
+                MSG_NOSIGNAL, // Flags
+                cast(struct sockaddr*, &remote_addr), addr_len
+            );
+        }
         WATCH2("send() len: %d actual: %d\n", len, result);
 
         if (result >= 0) {
-            req->common.data += result;
+            if (req->common.data)
+                req->common.data += result;
             req->actual += result;
             if (req->actual >= req->length) {
                 rebElide(
@@ -470,26 +663,51 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         // if (result < 0) ...
     }
     else {
-        assert(VAL_INDEX(req->common.binary) == 0);
-
+        // The index of the BINARY! is how far the reader has consumed, and
+        // doesn't matter here--received bytes always go at the tail.  If the
+        // buffer lost its spare capacity since READ prepared it (e.g. to a
+        // COPY/SHARE) it must be extended, since a recv() into 0 bytes would
+        // look like the socket closing.
+        //
         REBBIN *bin = VAL_BINARY(req->common.binary);
-        assert(SER_AVAIL(bin) >= len);
+        if (SER_AVAIL(bin) < NET_BUF_SIZE / 2)
+            Extend_Series(bin, NET_BUF_SIZE);
+
         REBLEN old_len = BIN_LEN(bin);
+        REBLEN total = 0;  // received by this call, maybe over several recv()
+
+        while (true) {
+            len = SER_AVAIL(bin);
+            result = recvfrom(
+                req->requestee.socket,
+                s_cast(BIN_AT(bin, old_len + total)), len,
+                0, // Flags
+                cast(struct sockaddr*, &remote_addr), &addr_len
+            );
+            WATCH2("recv() len: %d result: %d\n", len, result);
+
+            if (result <= 0)
+                break;
+
+            total += result;
+            TERM_BIN_LEN(bin, old_len + total);  // Extend only keeps BIN_LEN
+
+            if (
+                (req->modes & RST_UDP)  // one datagram per READ
+                or cast(size_t, result) < len  // socket has been drained
+                or total >= NET_BUF_MAX_READ  // let the reader catch up
+            ){
+                break;
+            }
 
-        result = recvfrom(
-            req->requestee.socket,
-            s_cast(BIN_AT(bin, old_len)), len,
-            0, // Flags
-            cast(struct sockaddr*, &remote_addr), &addr_len
-        );
-        WATCH2("recv() len: %d result: %d\n", len, result);
+            Extend_Series(bin, total);  // filled it, so likely more
+        }
 
-        if (result > 0) {
+        if (total > 0) {
             if (req->modes & RST_UDP) {
                 ReqNet(sock)->remote_ip = remote_addr.sin_addr.s_addr;
                 ReqNet(sock)->remote_port = ntohs(remote_addr.sin_port);
             }
-            TERM_BIN_LEN(bin, old_len + result);
 
             rebElide(
                 "insert system/ports/system make event! [",
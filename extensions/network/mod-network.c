@@ -28,8 +28,6 @@
 
 #include "tmp-mod-network.h"
 
-#define NET_BUF_SIZE 32*1024
-
 enum Transport_Types {
     TRANSPORT_TCP,
     TRANSPORT_UDP
@@ -71,6 +69,30 @@ static void Query_Net(REBVAL *out, REBVAL *port, struct devreq_net *sock)
 }
 
 
+//
+//  Release_Gathered_Pieces: C
+//
+// A WRITE of a BLOCK! puts a HOLD on each of its pieces until the WROTE event
+// (see SYM_WRITE below).  This lets them go, and blanks the cells in the
+// private copy of the block, so that a second call (e.g. CLOSE and then a
+// WROTE event already queued) can't release a hold someone else has taken.
+//
+static void Release_Gathered_Pieces(REBVAL *port_data)
+{
+    if (not IS_BLOCK(port_data))
+        return;
+
+    RELVAL *item = VAL_ARRAY_HEAD(port_data);
+    for (; NOT_END(item); ++item) {
+        if (not IS_BINARY(item) and not IS_TEXT(item))
+            continue;
+
+        CLEAR_SERIES_INFO(VAL_SERIES(item), HOLD);
+        Init_Blank(item);
+    }
+}
+
+
 //
 //  Transport_Actor: C
 //
@@ -98,8 +120,13 @@ static REB_R Transport_Actor(
     // being written...and text was allowed (even though it might be wide
     // characters, a likely oversight from the addition of unicode).
     //
+    // A WRITE of a BLOCK! holds the block, and SEND-FILE holds the file port.
+    //
     REBVAL *port_data = CTX_VAR(ctx, STD_PORT_DATA);
-    assert(IS_BINARY(port_data) or IS_TEXT(port_data) or IS_BLANK(port_data));
+    assert(
+        IS_BINARY(port_data) or IS_TEXT(port_data) or IS_BLANK(port_data)
+        or IS_BLOCK(port_data) or IS_PORT(port_data)
+    );
 
     // sock->timeout = 4000; // where does this go? !!!
 
@@ -226,7 +253,7 @@ static REB_R Transport_Actor(
         case SYM_LENGTH: {
             return Init_Integer(
                 D_OUT,
-                IS_BINARY(port_data) ? VAL_LEN_HEAD(port_data) : 0
+                IS_BINARY(port_data) ? VAL_LEN_AT(port_data) : 0
             ); }
 
         case SYM_OPEN_Q:
@@ -261,25 +288,31 @@ static REB_R Transport_Actor(
             ASSERT_SERIES_TERM(VAL_BINARY(port_data));
         }
         else if (req->command == RDC_WRITE) {
-            enum Reb_Kind kind = VAL_TYPE(port_data);
-            assert(kind == REB_BINARY or kind == REB_TEXT);
-            UNUSED(kind);
+            assert(req->common.binary == port_data);
+            assert(req->actual >= req->length);
 
             // !!! Still uses the convention of passing a byte pointer to
             // the device layer, vs. a BINARY!.  Pointer is advanced on each
             // section of write.  WROTE event happens only when all the data
-            // has been written.
+            // has been written.  (BLOCK! and PORT! writes don't use the
+            // pointer, the device finds its place using req->actual.)
             //
-            REBSIZ size;
-            assert(
-                req->common.data ==
-                    VAL_BYTES_AT(&size, port_data) + req->length
-            );
-            UNUSED(size);
+          #if !defined(NDEBUG)
+            if (IS_BINARY(port_data) or IS_TEXT(port_data)) {
+                REBSIZ size;
+                assert(
+                    req->common.data ==
+                        VAL_BYTES_AT(&size, port_data) + req->length
+                );
+            }
+            else
+                assert(IS_BLOCK(port_data) or IS_PORT(port_data));
+          #endif
 
             // !!! R3-Alpha said "write is done" here, and threw away the
             // port data by blanking it.  But was it done?
             //
+            Release_Gathered_Pieces(port_data);
             Init_Blank(port_data);
         }
         else
@@ -332,11 +365,28 @@ static REB_R Transport_Actor(
             //         ]
             //     ]
             //
+            // Ren-C lets the client say how much it has used with CONSUME,
+            // which moves the index of the BINARY! up.  Bytes before the
+            // index are dead, so if they are at least half the buffer they
+            // get reclaimed instead of growing it.  (Reclaiming on every
+            // READ would be a memmove of the live bytes each time; waiting
+            // for half means each byte moves a bounded number of times.)
+            //
             buffer = VAL_BINARY(port_data);
 
-            // !!! Port code doesn't skip the index, but what if user does?
-            //
-            assert(VAL_INDEX(port_data) == 0);
+            REBLEN consumed = VAL_INDEX(port_data);
+            if (consumed > BIN_LEN(buffer))
+                consumed = BIN_LEN(buffer);  // user may have shortened it
+
+            if (
+                SER_AVAIL(buffer) < NET_BUF_SIZE / 2
+                and consumed != 0
+                and consumed >= BIN_LEN(buffer) - consumed
+            ){
+                Remove_Series_Units(buffer, 0, consumed);
+                Unbias_Series(buffer, true);
+                VAL_INDEX(port_data) = 0;
+            }
 
             if (SER_AVAIL(buffer) < NET_BUF_SIZE / 2)
                 Extend_Series(buffer, NET_BUF_SIZE);
@@ -381,37 +431,90 @@ static REB_R Transport_Actor(
             fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
         }
 
-        // Determine length. Clip /PART to size of string if needed.
         REBVAL *data = ARG(data);
 
-        REBLEN len = VAL_LEN_AT(data);
-        if (REF(part)) {
-            REBLEN n = Int32s(ARG(part), 0);
-            if (n <= len)
-                len = n;
+        if (IS_BLOCK(data)) {
+            //
+            // A BLOCK! of BINARY! and TEXT! pieces is sent by the device with
+            // gathering sends, without joining the pieces into one buffer.
+            // The device reads the pieces over several calls, so the port
+            // data gets a private copy of the block, and each piece is put
+            // in a HOLD until the WROTE event (or CLOSE) releases it.
+            //
+            if (REF(part))
+                fail (Error_Bad_Refines_Raw());
+
+            RELVAL *item = VAL_ARRAY_AT(data);
+            for (; NOT_END(item); ++item) {
+                if (not IS_BINARY(item) and not IS_TEXT(item))
+                    fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(data)));
+            }
+
+            Init_Block(
+                port_data,  // GC-safety (blanked on UPDATE)
+                Copy_Array_At_Shallow(
+                    VAL_ARRAY(data), VAL_INDEX(data), VAL_SPECIFIER(data)
+                )
+            );
+
+            REBLEN total = 0;
+            item = VAL_ARRAY_HEAD(port_data);
+            for (; NOT_END(item); ++item) {
+                REBSIZ size;
+                const REBYTE *bp = VAL_BYTES_AT(&size, item);
+
+                // A piece already in a HOLD (by an enumeration, or because
+                // it appears twice in the block) would be let go early by
+                // Release_Gathered_Pieces(), so that piece is copied.
+                //
+                if (GET_SERIES_INFO(VAL_SERIES(item), HOLD))
+                    Init_Binary(item, Copy_Bytes(bp, size));
+
+                SET_SERIES_INFO(VAL_SERIES(item), HOLD);
+                total += size;
+            }
+
+            req->common.data = nullptr;  // device walks the block instead
+            req->common.binary = port_data;
+            req->length = total;
+            req->actual = 0;
         }
+        else {
+            if (not IS_BINARY(data) and not IS_TEXT(data))
+                fail (PAR(data));
 
-        // Setup the write:
+            // Determine length. Clip /PART to size of string if needed.
 
-        // !!! R3-Alpha did not lay out the invariants of the port model,
-        // or what datatypes it would accept at what levels.  TEXT! could be
-        // sent here--and it once could be wide characters or Latin1 without
-        // the user having knowledge of which.  UTF-8 everywhere has resolved
-        // that point (always UTF-8 bytes)...but the port model needs a top
-        // to bottom review of what types are accepted where and why.
-        //
-        // !!! Uses m_cast, but should not modify!
+            REBLEN len = VAL_LEN_AT(data);
+            if (REF(part)) {
+                REBLEN n = Int32s(ARG(part), 0);
+                if (n <= len)
+                    len = n;
+            }
 
-        assert(IS_BINARY(data) or IS_TEXT(data));
-        Move_Value(port_data, data);  // GC-safety (blanked out on UPDATE)
+            // Setup the write:
 
-        REBSIZ size;
-        req->common.data = m_cast(REBYTE*, VAL_BYTES_AT(&size, data));
-        assert(len == size);
-        UNUSED(size);
-        req->length = len;
+            // !!! R3-Alpha did not lay out the invariants of the port model,
+            // or what datatypes it would accept at what levels.  TEXT! could
+            // be sent here--and it once could be wide characters or Latin1
+            // without the user having knowledge of which.  UTF-8 everywhere
+            // has resolved that point (always UTF-8 bytes)...but the port
+            // model needs a top to bottom review of what types are accepted
+            // where and why.
+            //
+            // !!! Uses m_cast, but should not modify!
+
+            Move_Value(port_data, data);  // GC-safety (blanked on UPDATE)
 
-        req->actual = 0;
+            REBSIZ size;
+            req->common.data = m_cast(REBYTE*, VAL_BYTES_AT(&size, data));
+            assert(len == size);
+            UNUSED(size);
+            req->common.binary = port_data;
+            req->length = len;
+
+            req->actual = 0;
+        }
 
         REBVAL *result = OS_DO_DEVICE(sock, RDC_WRITE);
 
@@ -420,8 +523,10 @@ static REB_R Transport_Actor(
             // Write pending !!! old comment said "do we get here?"
         }
         else {
-            if (rebDid("error?", result, rebEND))
+            if (rebDid("error?", result, rebEND)) {
+                Release_Gathered_Pieces(port_data);
                 rebJumps("FAIL", result, rebEND);
+            }
 
             // Note here said "send CAN happen immediately"
             //
@@ -464,6 +569,7 @@ static REB_R Transport_Actor(
     case SYM_CLOSE: {
         if (req->flags & RRF_OPEN) {
             OS_DO_DEVICE_SYNC(sock, RDC_CLOSE);
+            Release_Gathered_Pieces(port_data);  // WROTE event may not come
 
             req->flags &= ~RRF_OPEN;
         }
@@ -565,6 +671,279 @@ REBNATIVE(get_udp_actor_handle)
 }
 
 
+//
+//  export consume: native [
+//
+//  {Mark bytes at the head of a network port's received data as used}
+//
+//      return: [binary!]
+//          {The port's unconsumed data (a view of the buffer, not a copy)}
+//      port [port!]
+//          {A TCP or UDP port which has been READ from}
+//      amount [integer! binary!]
+//          {Number of bytes used, or position in the port's data to skip to}
+//  ]
+//
+REBNATIVE(consume)
+//
+// R3-Alpha clients of network ports did `remove/part port/data n` when they
+// were done with some of the input, which is a memmove of all the remaining
+// bytes every time.  Consuming just moves the index of the port's BINARY!,
+// and the space is reclaimed in bulk by the next READ that needs it.
+{
+    NETWORK_INCLUDE_PARAMS_OF_CONSUME;
+
+    REBVAL *port_data = CTX_VAR(VAL_CONTEXT(ARG(port)), STD_PORT_DATA);
+    if (not IS_BINARY(port_data))
+        fail ("CONSUME needs a port which has received data");
+
+    REBLEN index = VAL_INDEX(port_data);
+    REBLEN len = VAL_LEN_HEAD(port_data);
+
+    REBLEN at;
+    if (IS_INTEGER(ARG(amount))) {
+        REBINT n = VAL_INT32(ARG(amount));
+        if (n < 0)
+            fail (PAR(amount));
+        at = index + n;
+    }
+    else {
+        if (VAL_SERIES(ARG(amount)) != VAL_SERIES(port_data))
+            fail (PAR(amount));
+        at = VAL_INDEX(ARG(amount));
+    }
+
+    if (at < index)
+        at = index;  // consumed data can't be given back
+    if (at > len)
+        at = len;
+
+    VAL_INDEX(port_data) = at;
+    RETURN (port_data);
+}
+
+
+// Most chunk size lines are a few hex digits, but they may carry extensions
+// (`;name=value`).  A line longer than this without an LF is not HTTP.
+//
+#define MAX_CHUNK_LINE 4096
+
+//
+//  export decode-chunked: native [
+//
+//  {Decode HTTP/1.1 chunked data received by a port, appending it to OUT}
+//
+//      return: [integer! binary!]
+//          {Bytes still expected for the current chunk, or trailer when done}
+//      out [binary!]
+//          {Where the decoded body is appended}
+//      port [port!]
+//          {Port whose data is decoded (what is decoded is CONSUME'd)}
+//      pending [integer!]
+//          {What the last call for this body returned (0 at the start)}
+//  ]
+//
+REBNATIVE(decode_chunked)
+//
+// prot-http.r used PARSE to find each chunk size line, waited for all of a
+// chunk to arrive, then copied it out--starting over at the top of the
+// buffer on each READ.  This decodes all that has arrived (including part
+// of a chunk, which the INTEGER! result tracks between calls) and never
+// looks at a byte twice.  The chunk size lines are not copied anywhere.
+//
+// The INTEGER! counts the CR LF after the chunk data, so 0 means a chunk
+// size line is next.  When the last chunk has been seen, the trailer header
+// lines (without the blank line that ends them) are returned as a BINARY!,
+// which is empty if there were none.
+{
+    NETWORK_INCLUDE_PARAMS_OF_DECODE_CHUNKED;
+
+    REBVAL *port_data = CTX_VAR(VAL_CONTEXT(ARG(port)), STD_PORT_DATA);
+    if (not IS_BINARY(port_data))
+        fail ("DECODE-CHUNKED needs a port which has received data");
+
+    REBSER *out = VAL_SERIES(ARG(out));
+    FAIL_IF_READ_ONLY_SER(out);
+    if (out == VAL_SERIES(port_data))
+        fail (PAR(out));
+
+    REBINT pending = VAL_INT32(ARG(pending));
+    if (pending < 0)
+        fail (PAR(pending));
+
+    REBYTE *head = VAL_BIN_AT(port_data);
+    REBYTE *end = head + VAL_LEN_AT(port_data);
+    REBYTE *cp = head;
+
+    while (true) {
+        if (pending > 2) {  // in the data of a chunk
+            REBLEN n = MIN(cast(REBLEN, end - cp), cast(REBLEN, pending - 2));
+            if (n == 0)
+                break;
+            Append_Series(out, cp, n);
+            cp += n;
+            pending -= n;
+            continue;
+        }
+
+        if (pending != 0) {  // in the CR LF after the data of a chunk
+            if (cp == end)
+                break;
+            if (*cp != (pending == 2 ? CR : LF))
+                fail ("Bad CR LF after HTTP chunk data");
+            ++cp;
+            --pending;
+            continue;
+        }
+
+        REBYTE *line = cp;  // chunk size line is `hex [;extensions] CR LF`
+        REBYTE *lf = cast(REBYTE*, memchr(cp, LF, end - cp));
+        if (not lf) {
+            if (end - cp > MAX_CHUNK_LINE)
+                fail ("HTTP chunk size line too long");
+            break;  // wait for more data
+        }
+
+        REBI64 size = 0;
+        for (; cp != lf; ++cp) {
+            REBYTE b = *cp;
+            REBINT digit;
+            if (b >= '0' and b <= '9')
+                digit = b - '0';
+            else if (b >= 'a' and b <= 'f')
+                digit = b - 'a' + 10;
+            else if (b >= 'A' and b <= 'F')
+                digit = b - 'A' + 10;
+            else
+                break;
+            size = (size << 4) + digit;
+            if (size > INT32_MAX - 2)
+                fail ("HTTP chunk size too large");
+        }
+        if (cp == line or (*cp != ';' and *cp != ' ' and *cp != CR))
+            fail ("Bad HTTP chunk size line");
+        if (lf[-1] != CR)
+            fail ("HTTP chunk size line not ended by CR LF");
+        cp = lf + 1;
+
+        if (size != 0) {
+            pending = cast(REBINT, size) + 2;
+            continue;
+        }
+
+        // Last chunk.  The trailer is header lines ending with a blank line,
+        // which is just CR LF if there are no header lines.
+        //
+        REBLEN trailer_size;
+        REBYTE *after;
+        if (end - cp >= 2 and cp[0] == CR and cp[1] == LF) {
+            trailer_size = 0;
+            after = cp + 2;
+        }
+        else {
+            REBYTE *t = cp;
+            for (; end - t >= 4; ++t) {
+                if (t[0] == CR and t[1] == LF and t[2] == CR and t[3] == LF)
+                    break;
+            }
+            if (end - t < 4) {
+                cp = line;  // decode the last chunk again when trailer's in
+                break;
+            }
+            trailer_size = t - cp;
+            after = t + 4;
+        }
+
+        REBSER *trailer = Make_Binary(trailer_size);
+        Append_Series(trailer, cp, trailer_size);
+        VAL_INDEX(port_data) += after - head;
+        return Init_Binary(D_OUT, trailer);
+    }
+
+    VAL_INDEX(port_data) += cp - head;
+    return Init_Integer(D_OUT, pending);
+}
+
+
+//
+//  export send-file: native [
+//
+//  {Write an open file port's contents to a TCP port, bypassing the heap}
+//
+//      return: [port!]
+//      port [port!]
+//          {A connected TCP port}
+//      file [port!]
+//          {A file port open for reading, sent from its current position}
+//      /part
+//          {Limit the number of bytes sent}
+//          [integer!]
+//  ]
+//
+REBNATIVE(send_file)
+//
+// Serving a file with READ and WRITE brings all of it into a BINARY! first.
+// This gives the OS handle of the file to the network device instead, which
+// uses sendfile() where the platform has it.  The WROTE event comes when all
+// of it has been sent, as with WRITE.
+{
+    NETWORK_INCLUDE_PARAMS_OF_SEND_FILE;
+
+    REBVAL *port = ARG(port);
+    REBREQ *sock = Ensure_Port_State(port, &Dev_Net);
+    struct rebol_devreq *req = Req(sock);
+
+    if ((req->modes & RST_UDP) or not (req->state & RSM_CONNECT))
+        fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
+
+    // The file port's state is the request of the file device.  Its layout
+    // belongs to the filesystem extension, but the common part with the OS
+    // handle is all that the network device needs.
+    //
+    REBVAL *file = ARG(file);
+    REBCTX *file_ctx = VAL_CONTEXT(file);
+    REBVAL *file_state = CTX_VAR(file_ctx, STD_PORT_STATE);
+    if (
+        not rebDid(
+            "'file = select", CTX_VAR(file_ctx, STD_PORT_SPEC), "'scheme",
+        rebEND)
+        or not IS_BINARY(file_state)
+        or not (Req(VAL_BINARY(file_state))->flags & RRF_OPEN)
+    ){
+        fail (PAR(file));
+    }
+
+    int64_t len = Get_File_Remaining(VAL_BINARY(file_state));
+    if (REF(part)) {
+        int64_t n = VAL_INT64(ARG(part));
+        if (n < 0)
+            fail (PAR(part));
+        if (n < len)
+            len = n;
+    }
+    if (len > UINT32_MAX)
+        fail ("SEND-FILE can send at most 4GB per call (use /PART)");
+
+    REBVAL *port_data = CTX_VAR(VAL_CONTEXT(port), STD_PORT_DATA);
+    Move_Value(port_data, file);  // GC-safety (blanked out on UPDATE)
+
+    req->common.data = nullptr;  // device uses the file handle instead
+    req->common.binary = port_data;
+    req->length = cast(uint32_t, len);
+    req->actual = 0;
+
+    REBVAL *result = OS_DO_DEVICE(sock, RDC_WRITE);
+    if (result) {
+        if (rebDid("error?", result, rebEND))
+            rebJumps("FAIL", result, rebEND);
+
+        rebRelease(result); // ignore result
+    }
+
+    RETURN (port);
+}
+
+
 //
 //  export set-udp-multicast: native [
 //
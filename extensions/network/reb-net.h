@@ -23,6 +23,8 @@
 
 EXTERN_C REBDEV Dev_Net;
 
+EXTERN_C int64_t Get_File_Remaining(REBREQ *file);  // for SEND-FILE
+
 // REBOL Socket types:
 enum socket_types {
     RST_UDP     = 1 << 0,   // TCP or UDP
@@ -44,6 +46,16 @@ enum {
 
 #define IPA(a,b,c,d) (a<<24 | b<<16 | c<<8 | d)
 
+// TCP reads go into the `data` BINARY! of the port, and the index of that
+// BINARY! marks how much of it the reader has consumed (see CONSUME).  A read
+// makes sure at least half of NET_BUF_SIZE is free, reclaiming consumed space
+// at the head before growing the buffer.  When a recv() fills all the space
+// it was offered the socket probably has more, so the buffer grows and the
+// socket is drained (up to NET_BUF_MAX_READ) before signaling the READ event.
+//
+#define NET_BUF_SIZE (32 * 1024)
+#define NET_BUF_MAX_READ (1024 * 1024)
+
 struct devreq_net {
     struct rebol_devreq devreq;
     uint32_t local_ip;      // local address used
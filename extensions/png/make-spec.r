@@ -27,6 +27,7 @@ includes: [
     %prep/extensions/png
 ]
 depends: [
+    %png/u-png.c
     [
         %png/lodepng.c
 
@@ -47,6 +47,17 @@
 #include "tmp-mod-png.h"
 
 
+// Row-at-a-time decoding of the common kinds of PNG, see %u-png.c
+//
+extern bool Png_Rows_Decodable(
+    unsigned *w,
+    unsigned *h,
+    const REBYTE *data,
+    size_t size
+);
+extern void Decode_Png_Rows(REBYTE *rgba, const REBYTE *data, size_t size);
+
+
 //=//// CUSTOM SERIES-BACKED MEMORY ALLOCATOR /////////////////////////////=//
 //
 // LodePNG allows for a custom allocator.  %lodepng.h contains prototypes for
@@ -112,6 +123,13 @@ static unsigned rebol_zlib_decompress(
     return 0;
 }
 
+// The encoder's zlib settings go through `custom_context`, as this struct.
+//
+struct Reb_Png_Deflate {
+    int level;  // -1 is zlib's default
+    size_t block_size;  // bytes of filtered rows per independent block, or 0
+};
+
 static unsigned rebol_zlib_compress(
     unsigned char **out,
     size_t *outsize,
@@ -121,12 +139,22 @@ static unsigned rebol_zlib_compress(
 ){
     lodepng_free(*out); // see remarks in decompress, and about COMPRESS/INTO
 
-    assert(5 == *cast(const int*, settings->custom_context)); // just testing
-    UNUSED(settings->custom_context);
+    const struct Reb_Png_Deflate *opts = cast(
+        const struct Reb_Png_Deflate*, settings->custom_context
+    );
 
-    // PNG uses "zlib envelope" w/ADLER32 checksum, hence "Zdeflate"
+    // PNG uses "zlib envelope" w/ADLER32 checksum.  This is what DEFLATE
+    // does with /ENVELOPE 'ZLIB, so it can take a /LEVEL and /BLOCKS.
     //
-    *out = cast(unsigned char*, rebZdeflateAlloc(outsize, in, insize));
+    *out = Compress_Alloc_Core(
+        outsize,
+        in,
+        insize,
+        Canon(SYM_ZLIB),
+        opts->level,
+        nullptr,  // default strategy
+        opts->block_size
+    );
 
     return 0;
 }
@@ -185,6 +213,30 @@ REBNATIVE(identify_png_q)
 }
 
 
+// Pixels of the IMAGE! given to DECODE-PNG/INTO, which must be w x h.
+//
+static REBYTE *Png_Into_Pixels(REBVAL *image, unsigned w, unsigned h)
+{
+    FAIL_IF_READ_ONLY(image);
+
+    REBVAL *size = rebValue("pick", image, "'size", rebEND);
+    REBLEN width = rebUnboxInteger("pick", size, "'x", rebEND);
+    REBLEN height = rebUnboxInteger("pick", size, "'y", rebEND);
+    rebRelease(size);
+
+    if (width != w or height != h)
+        fail ("DECODE-PNG/INTO image is not the same size as the PNG");
+
+    // BYTES OF gives the image's own BINARY! (not a copy), see %t-image.c
+    //
+    REBVAL *bytes = rebValue("bytes of", image, rebEND);
+    REBYTE *pixels = VAL_BIN_HEAD(bytes);
+    rebRelease(bytes);
+
+    return pixels;
+}
+
+
 //
 //  decode-png: native [
 //
@@ -192,60 +244,87 @@ REBNATIVE(identify_png_q)
 //
 //      return: [image!]
 //      data [binary!]
+//      /into "Decode into this image (which must be the size of the PNG)"
+//          [image!]
 //  ]
 //
 REBNATIVE(decode_png)
+//
+// PNGs with 8 bits per channel that aren't interlaced (which is most of
+// them) are decoded a row at a time by %u-png.c, right into the pixels of
+// the result.  LodePNG does the others, into a buffer of the whole image.
 {
     PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
 
-    LodePNGState state;
-    lodepng_state_init(&state);
-
-    // use the zlib already built into Rebol for DECOMPRESS, inflate()
-    //
-    state.decoder.zlibsettings.custom_zlib = rebol_zlib_decompress;
-
-    // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put decompression settings or state in there)
-    //
-    int arg = 5;
-    state.decoder.zlibsettings.custom_context = &arg;
-
-    // Even if the input PNG doesn't have alpha or color, ask for conversion
-    // to RGBA.
-    //
-    state.decoder.color_convert = 1;
-    state.info_png.color.colortype = LCT_RGBA;
-    state.info_png.color.bitdepth = 8;
+    const REBYTE *data = VAL_BIN_AT(ARG(data));
+    size_t size = VAL_LEN_AT(ARG(data));
 
     unsigned char* image_bytes;
     unsigned w;
     unsigned h;
-    unsigned error = lodepng_decode(
-        &image_bytes,
-        &w,
-        &h,
-        &state,
-        VAL_BIN_AT(ARG(data)), // PNG data
-        VAL_LEN_AT(ARG(data)) // PNG data length
-    );
-
-    // `state` can contain potentially interesting information, such as
-    // metadata (key="Software" value="REBOL", for instance).  Currently this
-    // is just thrown away, but it might be interesting to have access to.
-    // Because Rebol_Malloc() was used to make the strings, they could easily
-    // be Rebserize()'d and put in an object.
-    //
-    lodepng_state_cleanup(&state);
 
-    if (error != 0)
-        fail (lodepng_error_text(error));
-
-    // Note LodePNG cannot decode into an existing buffer, though it has been
-    // requested:
-    //
-    // https://github.com/lvandeve/lodepng/issues/17
-    //
+    if (Png_Rows_Decodable(&w, &h, data, size)) {
+        if (REF(into)) {
+            Decode_Png_Rows(Png_Into_Pixels(ARG(into), w, h), data, size);
+            RETURN (ARG(into));
+        }
+
+        image_bytes = rebAllocN(REBYTE, (w * h) * 4);  // for rebRepossess()
+        Decode_Png_Rows(image_bytes, data, size);
+    }
+    else {
+        LodePNGState state;
+        lodepng_state_init(&state);
+
+        // use the zlib already built into Rebol for DECOMPRESS, inflate()
+        //
+        state.decoder.zlibsettings.custom_zlib = rebol_zlib_decompress;
+
+        // this is how to pass an arbitrary void* that custom zlib can access
+        // (so one could put decompression settings or state in there)
+        //
+        int arg = 5;
+        state.decoder.zlibsettings.custom_context = &arg;
+
+        // Even if the input PNG doesn't have alpha or color, ask for
+        // conversion to RGBA.
+        //
+        state.decoder.color_convert = 1;
+        state.info_png.color.colortype = LCT_RGBA;
+        state.info_png.color.bitdepth = 8;
+
+        unsigned error = lodepng_decode(
+            &image_bytes,
+            &w,
+            &h,
+            &state,
+            data, // PNG data
+            size // PNG data length
+        );
+
+        // `state` can contain potentially interesting information, such as
+        // metadata (key="Software" value="REBOL", for instance).  Currently
+        // this is just thrown away, but it might be interesting to have
+        // access to.  Because Rebol_Malloc() was used to make the strings,
+        // they could easily be Rebserize()'d and put in an object.
+        //
+        lodepng_state_cleanup(&state);
+
+        if (error != 0)
+            fail (lodepng_error_text(error));
+
+        // Note LodePNG cannot decode into an existing buffer, though it has
+        // been requested:
+        //
+        // https://github.com/lvandeve/lodepng/issues/17
+        //
+        if (REF(into)) {
+            REBYTE *pixels = Png_Into_Pixels(ARG(into), w, h);
+            memcpy(pixels, image_bytes, (w * h) * 4);
+            rebFree(image_bytes);
+            RETURN (ARG(into));
+        }
+    }
 
     REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
 
@@ -269,14 +348,70 @@ REBNATIVE(decode_png)
 //
 //      return: [binary!]
 //      image [image!]
+//      /filter "NONE, SUB, UP, AVERAGE or PAETH for every row, or MINSUM"
+//          [word!]
+//      /level "Deflate level, 0 (store only) to 9 (smallest but slowest)"
+//          [integer!]
+//      /fast "Favor speed: the SUB filter and level 1, unless overridden"
+//      /bands "Deflate each band of this many rows independently (as pigz)"
+//          [integer!]
 // ]
 //
 REBNATIVE(encode_png)
+//
+// The default picks each row's filter by the "minimum sum" heuristic of the
+// PNG spec, which means trying all five on every row.  A single filter for
+// the whole image skips that.  SUB with deflate level 1 (/FAST) is about
+// four times quicker than the default on screenshots, for files a little
+// larger (SUB also beat UP in both time and size on them).
+//
+// /BANDS gives PNG data that any decoder reads as one zlib stream, but
+// where each band of rows is deflated on its own (as DEFLATE/BLOCKS does).
+// The bands are compressed at the same time on up to TASK-THREADS threads,
+// by Deflate_Blocks() in %u-compress.c (whose tasks use zlib's malloc()
+// allocator instead of rebMalloc(), so they don't touch the interpreter).
 {
     PNG_INCLUDE_PARAMS_OF_ENCODE_PNG;
 
     REBVAL *image = ARG(image);
 
+    REBVAL *size = rebValue("pick", image, "'size", rebEND);
+    REBLEN width = rebUnboxInteger("pick", size, "'x", rebEND);
+    REBLEN height = rebUnboxInteger("pick", size, "'y", rebEND);
+    rebRelease(size);
+
+    struct Reb_Png_Deflate opts;
+    opts.level = REF(fast) ? 1 : -1;  // -1 is zlib's default (6)
+    opts.block_size = 0;
+
+    if (REF(level)) {
+        opts.level = Int32(ARG(level));
+        if (opts.level < 0 or opts.level > 9)
+            fail (PAR(level));
+    }
+
+    int filter_type = REF(fast) ? 1 : -1;  // SUB for /FAST, else MINSUM
+    if (REF(filter)) {
+        switch (VAL_WORD_SYM(ARG(filter))) {
+          case SYM_NONE: filter_type = 0; break;
+          case SYM_SUB: filter_type = 1; break;
+          case SYM_UP: filter_type = 2; break;
+          case SYM_AVERAGE: filter_type = 3; break;
+          case SYM_PAETH: filter_type = 4; break;
+          case SYM_MINSUM: filter_type = -1; break;
+
+          default:
+            fail (PAR(filter));
+        }
+    }
+
+    if (REF(bands)) {
+        REBINT rows = Int32(ARG(bands));
+        if (rows <= 0)
+            fail (PAR(bands));
+        opts.block_size = cast(size_t, rows) * (1 + width * 4);
+    }
+
     // Historically, Rebol would write (key="Software" value="REBOL") into
     // image metadata.  Is that interesting?  If so, the state has fields for
     // this...assuming the encoder pays attention to them (the decoder does).
@@ -287,12 +422,18 @@ REBNATIVE(encode_png)
     // use the zlib already built into Rebol for DECOMPRESS, deflate()
     //
     state.encoder.zlibsettings.custom_zlib = rebol_zlib_compress;
+    state.encoder.zlibsettings.custom_context = &opts;
 
-    // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put dompression settings or state in there)
+    // LFS_PREDEFINED takes a filter type for each row, which is the same
+    // one for all of them here.
     //
-    int arg = 5;
-    state.encoder.zlibsettings.custom_context = &arg;
+    REBYTE *filters = nullptr;
+    if (filter_type >= 0) {
+        filters = rebAllocN(REBYTE, height);
+        memset(filters, filter_type, height);
+        state.encoder.filter_strategy = LFS_PREDEFINED;
+        state.encoder.predefined_filters = filters;
+    }
 
     // input format
     //
@@ -310,13 +451,11 @@ REBNATIVE(encode_png)
     //
     state.encoder.auto_convert = 0;
 
-    REBVAL *size = rebValue("pick", image, "'size", rebEND);
-    REBLEN width = rebUnboxInteger("pick", size, "'x", rebEND);
-    REBLEN height = rebUnboxInteger("pick", size, "'y", rebEND);
-    rebRelease(size);
-
-    size_t binsize;
-    REBYTE *image_bytes = rebBytes(&binsize, "bytes of", image, rebEND);
+    // BYTES OF gives the image's own BINARY!, so the pixels aren't copied
+    // (LodePNG only reads them).
+    //
+    REBVAL *bytes = rebValue("bytes of", image, rebEND);
+    const REBYTE *image_bytes = VAL_BIN_HEAD(bytes);
 
     size_t encoded_size;
     REBYTE *encoded_bytes = NULL;
@@ -330,7 +469,9 @@ REBNATIVE(encode_png)
     );
     lodepng_state_cleanup(&state);
 
-    rebFree(image_bytes);
+    rebRelease(bytes);
+    if (filters)
+        rebFree(filters);
 
     if (error != 0)
         fail (lodepng_error_text(error));
@@ -0,0 +1,535 @@
+//
+//  File: %u-png.c
+//  Summary: "row-at-a-time PNG decoding straight into RGBA"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// LodePNG decodes in whole-image steps: it inflates all of the IDAT data
+// into one buffer of filtered scanlines, unfilters that in place, and then
+// converts it into a third buffer of the requested color type.  So a large
+// image passes through memory three times, and needs about twice its size
+// in temporary space.
+//
+// The PNGs that are most common (8 bits per channel, not interlaced) can
+// instead be inflated a scanline at a time into a two-row buffer, and each
+// row unfiltered and converted right into its place in the RGBA output.
+// Other kinds (16-bit, fewer than 8 bits, Adam7 interlacing) are rare
+// enough that %mod-png.c leaves them to LodePNG.
+//
+// The Sub, Average and Paeth filters depend on the pixel to the left, so
+// they go a pixel at a time.  For 3 and 4 byte pixels, SSE2 does all the
+// channels of a pixel at once (as libpng does).  SSE2 is always present on
+// x86-64 (CPU_X86_SSE2 in %sys-cpu.h), so there's no CPUID check.
+//
+
+#include "sys-core.h"
+#include "sys-zlib.h"
+
+
+static const REBYTE png_signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+// Signature, then IHDR's length, type, 13 bytes of data and CRC
+//
+#define PNG_HEADER_SIZE (8 + 4 + 4 + 13 + 4)
+
+inline static uint32_t Png_U32(const REBYTE *p) {
+    return (cast(uint32_t, p[0]) << 24) | (cast(uint32_t, p[1]) << 16)
+        | (cast(uint32_t, p[2]) << 8) | cast(uint32_t, p[3]);
+}
+
+inline static bool Png_Chunk_Is(const REBYTE *type, const char *name) {
+    return memcmp(type, name, 4) == 0;
+}
+
+
+// Bytes per pixel of the 8-bit color types (0 for ones not handled here)
+//
+static unsigned Png_Bytes_Per_Pixel(REBYTE colortype) {
+    switch (colortype) {
+      case 0: return 1;  // gray
+      case 2: return 3;  // RGB
+      case 3: return 1;  // palette index
+      case 4: return 2;  // gray and alpha
+      case 6: return 4;  // RGBA
+      default: return 0;
+    }
+}
+
+
+//
+//  Png_Rows_Decodable: C
+//
+// Read the size from the IHDR, and say if Decode_Png_Rows() can do the rest.
+// False doesn't mean the PNG is bad, LodePNG may still decode it (or give
+// the right error).
+//
+bool Png_Rows_Decodable(
+    unsigned *w,
+    unsigned *h,
+    const REBYTE *data,
+    size_t size
+){
+    if (size < PNG_HEADER_SIZE or memcmp(data, png_signature, 8) != 0)
+        return false;
+
+    const REBYTE *ihdr = data + 8;
+    if (Png_U32(ihdr) != 13 or not Png_Chunk_Is(ihdr + 4, "IHDR"))
+        return false;
+
+    *w = Png_U32(ihdr + 8);
+    *h = Png_U32(ihdr + 12);
+    if (*w == 0 or *h == 0)
+        return false;
+    if (cast(uint64_t, *w) * *h > UINT32_MAX / 4)
+        return false;
+
+    REBYTE bitdepth = ihdr[16];
+    REBYTE colortype = ihdr[17];
+    REBYTE compression = ihdr[18];
+    REBYTE filter = ihdr[19];
+    REBYTE interlace = ihdr[20];
+
+    return bitdepth == 8
+        and Png_Bytes_Per_Pixel(colortype) != 0
+        and compression == 0 and filter == 0 and interlace == 0;
+}
+
+
+inline static REBYTE Paeth(int a, int b, int c) {
+    int pa = b - c;  // the distances of a + b - c from a, b and c
+    int pb = a - c;
+    int pc = pa + pb;
+    if (pa < 0) pa = -pa;
+    if (pb < 0) pb = -pb;
+    if (pc < 0) pc = -pc;
+    if (pa <= pb and pa <= pc)
+        return cast(REBYTE, a);
+    if (pb <= pc)
+        return cast(REBYTE, b);
+    return cast(REBYTE, c);
+}
+
+
+#ifdef CPU_X86_SSE2
+    inline static __m128i Load_Pixel(const REBYTE *p) {
+        int32_t pixel;
+        memcpy(&pixel, p, 4);
+        return _mm_cvtsi32_si128(pixel);
+    }
+
+    inline static void Store_Pixel(REBYTE *p, __m128i v) {
+        int32_t pixel = _mm_cvtsi128_si32(v);
+        memcpy(p, &pixel, 4);
+    }
+
+    inline static __m128i Abs_Epi16(__m128i x) {
+        return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+    }
+
+    inline static __m128i Select(__m128i mask, __m128i yes, __m128i no) {
+        return _mm_or_si128(
+            _mm_and_si128(mask, yes), _mm_andnot_si128(mask, no)
+        );
+    }
+
+    // Up for any pixel size, and Sub, Average and Paeth for 3 or 4 byte
+    // pixels.  Returns false for what is left to the C loop.
+    //
+    // Pixels are always moved as 4 bytes.  With 3 byte pixels the fourth is
+    // the first byte of the next pixel: the lane added to it is kept zero,
+    // so it's written back unchanged.  (So the rows need a byte of slack.)
+    //
+    static bool Unfilter_Row_SSE2(
+        REBYTE *row,
+        const REBYTE *prev,
+        REBYTE filter,
+        size_t len,
+        unsigned bpp
+    ){
+        if (filter == 2) {
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                __m128i up = _mm_add_epi8(
+                    _mm_loadu_si128((const __m128i*)(row + i)),
+                    _mm_loadu_si128((const __m128i*)(prev + i))
+                );
+                _mm_storeu_si128((__m128i*)(row + i), up);
+            }
+            for (; i < len; ++i)
+                row[i] += prev[i];
+            return true;
+        }
+
+        if (bpp != 3 and bpp != 4)
+            return false;
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i mask = _mm_cvtsi32_si128(
+            bpp == 4 ? -1 : 0x00FFFFFF
+        );
+        __m128i a = zero;  // pixel to the left
+        __m128i c = zero;  // pixel above and to the left (16-bit lanes)
+        size_t i;
+
+        switch (filter) {
+          case 1:
+            for (i = 0; i < len; i += bpp) {
+                a = _mm_add_epi8(Load_Pixel(row + i), a);
+                Store_Pixel(row + i, a);
+                a = _mm_and_si128(a, mask);
+            }
+            return true;
+
+          case 3: {
+            const __m128i one = _mm_set1_epi8(1);
+            for (i = 0; i < len; i += bpp) {
+                __m128i b = _mm_and_si128(Load_Pixel(prev + i), mask);
+                __m128i avg = _mm_sub_epi8(  // PAVGB rounds up, PNG down
+                    _mm_avg_epu8(a, b),
+                    _mm_and_si128(_mm_xor_si128(a, b), one)
+                );
+                a = _mm_add_epi8(Load_Pixel(row + i), avg);
+                Store_Pixel(row + i, a);
+                a = _mm_and_si128(a, mask);
+            }
+            return true; }
+
+          case 4:
+            a = _mm_unpacklo_epi8(a, zero);  // a, b and c in 16-bit lanes
+            for (i = 0; i < len; i += bpp) {
+                __m128i b = _mm_unpacklo_epi8(
+                    _mm_and_si128(Load_Pixel(prev + i), mask), zero
+                );
+                __m128i d = Load_Pixel(row + i);
+
+                __m128i pa = _mm_sub_epi16(b, c);
+                __m128i pb = _mm_sub_epi16(a, c);
+                __m128i pc = Abs_Epi16(_mm_add_epi16(pa, pb));
+                pa = Abs_Epi16(pa);
+                pb = Abs_Epi16(pb);
+                __m128i least = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+                __m128i predict = Select(
+                    _mm_cmpeq_epi16(least, pa),
+                    a,
+                    Select(_mm_cmpeq_epi16(least, pb), b, c)
+                );
+
+                d = _mm_add_epi8(d, _mm_packus_epi16(predict, predict));
+                Store_Pixel(row + i, d);
+                a = _mm_unpacklo_epi8(_mm_and_si128(d, mask), zero);
+                c = b;
+            }
+            return true;
+
+          default:
+            return false;
+        }
+    }
+#endif
+
+
+// Undo the filter of one scanline, given the (already unfiltered) one above.
+//
+static void Unfilter_Row(
+    REBYTE *row,
+    const REBYTE *prev,
+    REBYTE filter,
+    size_t len,
+    unsigned bpp
+){
+  #ifdef CPU_X86_SSE2
+    if (Unfilter_Row_SSE2(row, prev, filter, len, bpp))
+        return;
+  #endif
+
+    size_t i;
+    switch (filter) {
+      case 0:  // None
+        break;
+
+      case 1:  // Sub
+        for (i = bpp; i < len; ++i)
+            row[i] += row[i - bpp];
+        break;
+
+      case 2:  // Up
+        for (i = 0; i < len; ++i)
+            row[i] += prev[i];
+        break;
+
+      case 3:  // Average
+        for (i = 0; i < bpp; ++i)
+            row[i] += prev[i] >> 1;
+        for (; i < len; ++i)
+            row[i] += cast(REBYTE, (row[i - bpp] + prev[i]) >> 1);
+        break;
+
+      case 4:  // Paeth
+        for (i = 0; i < bpp; ++i)
+            row[i] += prev[i];  // with nothing to the left, Paeth picks up
+        for (; i < len; ++i)
+            row[i] += Paeth(row[i - bpp], prev[i], prev[i - bpp]);
+        break;
+
+      default:
+        fail ("PNG scanline has an unknown filter type");
+    }
+}
+
+
+// What the conversion to RGBA needs to know besides the color type.  The
+// `key` is the tRNS color that is transparent in gray or RGB images, with
+// -1 for channels when there is none (so no byte can match).
+//
+struct Png_Colors {
+    REBYTE colortype;
+    int key_r;
+    int key_g;
+    int key_b;
+    REBYTE palette[256 * 4];
+};
+
+static void Row_To_RGBA(
+    REBYTE *out,
+    const REBYTE *in,
+    REBLEN w,
+    const struct Png_Colors *colors
+){
+    REBLEN x;
+    switch (colors->colortype) {
+      case 6:
+        memcpy(out, in, w * 4);
+        break;
+
+      case 2:  // copies 4 bytes at a time, so reads 1 past the row's end
+        for (x = 0; x < w; ++x, in += 3, out += 4) {
+            memcpy(out, in, 4);
+            out[3] = 255;
+        }
+        if (colors->key_r >= 0) {
+            out -= w * 4;
+            for (x = 0; x < w; ++x, out += 4) {
+                if (
+                    out[0] == colors->key_r
+                    and out[1] == colors->key_g
+                    and out[2] == colors->key_b
+                ){
+                    out[3] = 0;
+                }
+            }
+        }
+        break;
+
+      case 0:
+        for (x = 0; x < w; ++x, out += 4) {
+            out[0] = out[1] = out[2] = in[x];
+            out[3] = (in[x] == colors->key_r) ? 0 : 255;
+        }
+        break;
+
+      case 4:
+        for (x = 0; x < w; ++x, in += 2, out += 4) {
+            out[0] = out[1] = out[2] = in[0];
+            out[3] = in[1];
+        }
+        break;
+
+      case 3:
+        for (x = 0; x < w; ++x, out += 4)
+            memcpy(out, colors->palette + in[x] * 4, 4);
+        break;
+
+      default:
+        assert(false);
+    }
+}
+
+
+// Zlib's state comes from rebMalloc(), so a fail() during decoding frees it
+// (see the same in %u-compress.c)
+//
+static void *Png_Zalloc(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return rebMalloc(nr * size);
+}
+
+static void Png_Zfree(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    rebFree(addr);
+}
+
+
+//
+//  Decode_Png_Rows: C
+//
+// Decode a PNG that Png_Rows_Decodable() accepted into `rgba`, which has
+// room for its width * height pixels.  The IDAT chunks are inflated into
+// a scanline at a time, so only two rows of the filtered data are ever in
+// memory.  Errors in the data fail(), as do CRC and ADLER32 mismatches.
+//
+void Decode_Png_Rows(REBYTE *rgba, const REBYTE *data, size_t size)
+{
+    const REBYTE *ihdr = data + 8;
+    REBLEN w = Png_U32(ihdr + 8);
+    REBLEN h = Png_U32(ihdr + 12);
+
+    struct Png_Colors colors;
+    colors.colortype = ihdr[17];
+    colors.key_r = colors.key_g = colors.key_b = -1;
+
+    unsigned bpp = Png_Bytes_Per_Pixel(colors.colortype);
+    size_t stride = 1 + cast(size_t, w) * bpp;  // filter byte, then pixels
+
+    // Palette entries past what PLTE gives decode as opaque black, as they
+    // do in LodePNG (and most decoders), instead of being an error.
+    //
+    bool has_palette = false;
+    REBLEN i;
+    for (i = 0; i < 256; ++i) {
+        REBYTE *entry = colors.palette + i * 4;
+        entry[0] = entry[1] = entry[2] = 0;
+        entry[3] = 255;
+    }
+
+    REBYTE *rows = rebAllocN(REBYTE, 2 * stride + 1);  // +1 for 4 byte reads
+    REBYTE *prev = rows;
+    REBYTE *row = rows + stride;
+    memset(prev, 0, stride);  // the row above the first is all zeros
+
+    REBYTE overflow[64];  // where data past the last row goes, unused
+
+    z_stream strm;
+    strm.zalloc = &Png_Zalloc;
+    strm.zfree = &Png_Zfree;
+    strm.opaque = nullptr;
+    strm.next_in = nullptr;
+    strm.avail_in = 0;
+    if (inflateInit(&strm) != Z_OK)
+        fail ("Could not start inflating PNG image data");
+
+    strm.next_out = row;
+    strm.avail_out = stride;
+
+    REBLEN y = 0;
+    bool stream_end = false;
+
+    const REBYTE *end = data + size;
+    const REBYTE *chunk = data + PNG_HEADER_SIZE;
+    while (end - chunk >= 12) {
+        uint32_t len = Png_U32(chunk);
+        const REBYTE *type = chunk + 4;
+        const REBYTE *body = chunk + 8;
+        if (len > cast(size_t, end - chunk) - 12)
+            fail ("PNG chunk runs past the end of the data");
+
+        if (crc32_z(0, type, len + 4) != Png_U32(body + len))
+            fail ("PNG chunk has a bad CRC");
+
+        if (Png_Chunk_Is(type, "IEND"))
+            break;
+
+        if (Png_Chunk_Is(type, "PLTE")) {
+            if (len % 3 != 0 or len > 256 * 3)
+                fail ("PNG palette has a bad size");
+            for (i = 0; i < len / 3; ++i)
+                memcpy(colors.palette + i * 4, body + i * 3, 3);
+            has_palette = true;
+        }
+        else if (Png_Chunk_Is(type, "tRNS")) {
+            switch (colors.colortype) {
+              case 3:
+                if (len > 256)
+                    fail ("PNG transparency has a bad size");
+                for (i = 0; i < len; ++i)
+                    colors.palette[i * 4 + 3] = body[i];
+                break;
+
+              case 0:  // 16-bit sample, that only matches if it's < 256
+                if (len != 2)
+                    fail ("PNG transparency has a bad size");
+                if (body[0] == 0)
+                    colors.key_r = body[1];
+                break;
+
+              case 2:
+                if (len != 6)
+                    fail ("PNG transparency has a bad size");
+                if (body[0] == 0 and body[2] == 0 and body[4] == 0) {
+                    colors.key_r = body[1];
+                    colors.key_g = body[3];
+                    colors.key_b = body[5];
+                }
+                break;
+
+              default:
+                fail ("PNG transparency chunk with an alpha channel");
+            }
+        }
+        else if (Png_Chunk_Is(type, "IDAT") and not stream_end) {
+            if (colors.colortype == 3 and not has_palette)
+                fail ("PNG with a palette color type has no PLTE chunk");
+
+            strm.next_in = body;
+            strm.avail_in = len;
+            while (strm.avail_in != 0) {
+                int ret = inflate(&strm, Z_NO_FLUSH);
+                if (ret == Z_STREAM_END)
+                    stream_end = true;
+                else if (ret != Z_OK)
+                    fail (strm.msg ? strm.msg : "PNG image data is corrupt");
+
+                if (strm.avail_out == 0) {
+                    if (y < h) {
+                        Unfilter_Row(
+                            row + 1, prev + 1, row[0], stride - 1, bpp
+                        );
+                        Row_To_RGBA(rgba + y * w * 4, row + 1, w, &colors);
+                        ++y;
+
+                        REBYTE *temp = prev;
+                        prev = row;
+                        row = temp;
+                    }
+                    if (y < h) {
+                        strm.next_out = row;
+                        strm.avail_out = stride;
+                    }
+                    else {
+                        strm.next_out = overflow;
+                        strm.avail_out = sizeof(overflow);
+                    }
+                }
+
+                if (stream_end)
+                    break;
+            }
+        }
+
+        chunk = body + len + 4;
+    }
+
+    if (y < h or not stream_end)
+        fail ("PNG image data is truncated");
+
+    inflateEnd(&strm);
+    rebFree(rows);
+}
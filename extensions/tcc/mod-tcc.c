@@ -41,6 +41,7 @@
 
 #include "sys-core.h"
 #include "sys-ext.h"
+#include "sys-zlib.h"  // crc32_z() and adler32_z() for object cache keys
 
 #include "tmp-mod-tcc.h"
 
@@ -105,7 +106,7 @@ int tcc_set_lib_path_i(TCCState *s, const char *path)
 // dispatcher being used, these fields are used by "user natives"
 
 #define IDX_TCC_NATIVE_LINKNAME \
-    IDX_NATIVE_MAX // generated if the native doesn't specify
+    IDX_NATIVE_MAX // BLANK! if the native doesn't specify (see COMPILE*)
 
 #define IDX_TCC_NATIVE_STATE \
     IDX_TCC_NATIVE_LINKNAME + 1 // will be a BLANK! until COMPILE happens
@@ -250,6 +251,165 @@ static void cleanup(const REBVAL *val)
 }
 
 
+// All the states that COMPILE* makes are configured the same way from the
+// config object, whether they are the in-memory state the natives will live
+// in or a state which is only used to produce an object file for the cache.
+//
+static void Process_Config_Helper(TCCState *state, const REBVAL *config)
+{
+    void* opaque = cast(void*, EMPTY_BLOCK); // can parameterize the error...
+    tcc_set_error_func(state, opaque, &Error_Reporting_Hook);
+
+    // Sets options (same syntax as the TCC command line, minus commands like
+    // displaying the version or showing the TCC tool's help)
+    //
+    Process_Block_Helper(tcc_set_options_i, state, config, "options");
+
+    // Add include paths (same as `-I` in the options?)
+    //
+    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
+
+    // Add library paths (same as using `-L` in the options?)
+    //
+    Process_Block_Helper(tcc_add_library_path, state, config, "library-path");
+
+    // Add individual library files (same as using -l in the options?  e.g.
+    // the actual file is "libxxx.a" but you'd pass just `xxx` here)
+    //
+    // !!! Does this work for fully specified file paths as well?
+    //
+    Process_Block_Helper(tcc_add_library, state, config, "library");
+
+    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
+    // at runtime of the built code, presumably so libtcc1.a can be found.
+    //
+    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
+    // not clear what the call does.  The higher-level COMPILE goes ahead and
+    // sets the runtime path as an ordinary lib directory on Windows for the
+    // moment, since this seems to be a no-op there.  :-/
+    //
+    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+}
+
+
+// User natives that weren't given a /LINKNAME get one assigned at COMPILE*
+// time from their position in the batch ("N_1", "N_2"...).  Names only have
+// to be unique within one TCCState, and keeping them independent of heap
+// addresses means the same natives produce the same C source on every run...
+// which is what lets that source be used as a key for the object cache.
+//
+// A native in the batch may have been given one of those names explicitly,
+// so `taken` holds every name in use, and a suffix is added ("N_1_2"...)
+// until the generated name is not among them.
+//
+static REBVAL *Auto_Linkname_Helper(REBINT ordinal, const REBVAL *taken)
+{
+    REBVAL *name = rebValue("unspaced [{N_}", rebI(ordinal), "]", rebEND);
+
+    REBINT suffix = 2;
+    while (rebDid("find/case", taken, name, rebEND)) {
+        rebRelease(name);
+        name = rebValue(
+            "unspaced [{N_}", rebI(ordinal), "{_}", rebI(suffix), "]",
+        rebEND);
+        ++suffix;
+    }
+
+    rebElide("append", taken, name, rebEND);
+    return name;
+}
+
+
+// COMPILE can be given a CACHE-DIR, in which case the source of an in-memory
+// compilation is not handed to the memory state directly.  Instead it is
+// compiled to an object file in that directory, named by a hash of the key
+// (the source plus the CACHE-KEY that COMPILE derives from the options and
+// the interpreter version).  The memory state then loads the object file,
+// which means the only work done on a later run with the same natives is the
+// link step in tcc_relocate().
+//
+// The full key is stored next to the object file and compared on a hit, so
+// a hash collision can only cost a recompile--never the wrong code.
+//
+static void Compile_Via_Cache_Helper(
+    TCCState *state,
+    const REBVAL *config,
+    const REBVAL *source  // BINARY! of UTF-8 C source (0-terminated)
+){
+    REBVAL *key = rebValue(
+        "append copy", source, "ensure text! pick", config, "'cache-key",
+    rebEND);
+
+    REBSIZ key_size = VAL_LEN_AT(key);
+    uint32_t crc = cast(uint32_t, crc32_z(0L, VAL_BIN_AT(key), key_size));
+    uint32_t adler = cast(uint32_t, adler32_z(0L, VAL_BIN_AT(key), key_size));
+    int64_t hash = cast(int64_t, (cast(uint64_t, crc) << 32) | adler);
+
+    REBVAL *stem = rebValue(
+        "join ensure file! pick", config, "'cache-dir",
+            "unspaced [{tcc-} as text! to-hex", rebI(hash), "]",
+    rebEND);
+    REBVAL *obj_file = rebValue("join", stem, "%.o", rebEND);
+    REBVAL *key_file = rebValue("join", stem, "%.key", rebEND);
+    rebRelease(stem);
+
+    bool hit = rebDid(
+        "all [",
+            "exists?", obj_file,
+            "exists?", key_file,
+            "equal?", key, "read", key_file,
+        "]",
+    rebEND);
+
+    if (not hit) {
+        TCCState *obj_state = tcc_new();
+        if (not obj_state)
+            fail ("TCC failed to create a TCC context");
+
+        DECLARE_LOCAL (obj_handle);  // GC cleans up if compile fails
+        Init_Handle_Cdata_Managed(obj_handle, obj_state, 1, cleanup);
+        PUSH_GC_GUARD(obj_handle);
+
+        Process_Config_Helper(obj_state, config);
+        if (tcc_set_output_type(obj_state, TCC_OUTPUT_OBJ) < 0)
+            fail ("TCC failed to set output to OBJ for the compile cache");
+
+        if (tcc_compile_string(obj_state, cs_cast(VAL_BIN_AT(source))) < 0)
+            rebJumps ("fail [",
+                "{TCC failed to compile the code for cache file}", obj_file,
+            "]", rebEND);
+
+        char *obj_utf8 = rebSpell("file-to-local", obj_file, rebEND);
+        int status = tcc_output_file(obj_state, obj_utf8);
+        rebFree(obj_utf8);
+        if (status < 0)
+            rebJumps ("fail [",
+                "{TCC failed to write cache file}", obj_file,
+            "]", rebEND);
+
+        DROP_GC_GUARD(obj_handle);
+
+        // The key is written last, so an interrupted write of the object
+        // file can't be mistaken for a valid cache entry on the next run.
+        //
+        rebElide("write", key_file, key, rebEND);
+    }
+
+    char *obj_utf8 = rebSpell("file-to-local", obj_file, rebEND);
+    int status = tcc_add_file(state, obj_utf8);
+    rebFree(obj_utf8);
+
+    if (status < 0)
+        rebJumps ("fail [",
+            "{TCC failed to load cached object file}", obj_file,
+        "]", rebEND);
+
+    rebRelease(key_file);
+    rebRelease(obj_file);
+    rebRelease(key);
+}
+
+
 //
 //  Pending_Native_Dispatcher: C
 //
@@ -355,17 +515,10 @@ REBNATIVE(make_native)
         }
     }
     else {
-        // Auto-generate a linker name based on the numeric value of the
-        // paramlist pointer.  Just "N_" followed by the hexadecimal value.
-
-        REBARR *paramlist = ACT_PARAMLIST(native);  // unique for this action!
-        intptr_t heapaddr = cast(intptr_t, paramlist);
-        REBVAL *linkname = rebValue(
-            "unspaced [{N_} as text! to-hex", rebI(heapaddr), "]",
-        rebEND);
-
-        Move_Value(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME), linkname);
-        rebRelease(linkname);
+        // The linker name is generated by COMPILE* from the native's position
+        // in the batch (see Auto_Linkname_Helper()).
+        //
+        Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME));
     }
 
     Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_STATE)); // no TCC_State, yet...
@@ -421,43 +574,12 @@ REBNATIVE(compile_p)
     );
     PUSH_GC_GUARD(handle);
 
-    void* opaque = cast(void*, EMPTY_BLOCK); // can parameterize the error...
-    tcc_set_error_func(state, opaque, &Error_Reporting_Hook);
-
 
   //=//// SET UP OPTIONS FOR THE TCC STATE FROM CONFIG ////////////////////=//
 
     REBVAL *config = ARG(config);
 
-    // Sets options (same syntax as the TCC command line, minus commands like
-    // displaying the version or showing the TCC tool's help)
-    //
-    Process_Block_Helper(tcc_set_options_i, state, config, "options");
-
-    // Add include paths (same as `-I` in the options?)
-    //
-    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
-
-    // Add library paths (same as using `-L` in the options?)
-    //
-    Process_Block_Helper(tcc_add_library_path, state, config, "library-path");
-
-    // Add individual library files (same as using -l in the options?  e.g.
-    // the actual file is "libxxx.a" but you'd pass just `xxx` here)
-    //
-    // !!! Does this work for fully specified file paths as well?
-    //
-    Process_Block_Helper(tcc_add_library, state, config, "library");
-
-    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
-    // at runtime of the built code, presumably so libtcc1.a can be found.
-    //
-    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
-    // not clear what the call does.  The higher-level COMPILE goes ahead and
-    // sets the runtime path as an ordinary lib directory on Windows for the
-    // moment, since this seems to be a no-op there.  :-/
-    //
-    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+    Process_Config_Helper(state, config);
 
     // The output_type has to be set *before* you all tcc_output_file() or
     // tcc_relocate(), but has to be set *after* you've configured the
@@ -488,6 +610,12 @@ REBNATIVE(compile_p)
 
     REBDSP dsp_orig = DSP;  // natives are pushed to the stack
 
+    // Linker names of the natives, in the order they're pushed, and all the
+    // names used in the batch (see Auto_Linkname_Helper())
+    //
+    REBVAL *linknames = rebValue("copy []", rebEND);
+    REBVAL *taken = rebValue("copy []", rebEND);
+
     if (REF(files)) {
         RELVAL *item;
         for (item = VAL_ARRAY_AT(compilables); NOT_END(item); ++item) {
@@ -500,6 +628,8 @@ REBNATIVE(compile_p)
         }
 
         if (REF(inspect)) {  // nothing to show, besides the file list
+            rebRelease(taken);
+            rebRelease(linknames);
             DROP_GC_GUARD(handle);
             return rebText("/INSPECT => <file list>");
         }
@@ -513,10 +643,22 @@ REBNATIVE(compile_p)
         // and discard the data without ever making a TEXT! (as it would need
         // to if it were a client of the "external" libRebol API).
         //
+        // Explicit linker names come first, so generated ones avoid them.
+        //
+        RELVAL *item;
+        for (item = VAL_ARRAY_AT(compilables); NOT_END(item); ++item) {
+            if (not IS_ACTION(item))
+                continue;
+            RELVAL *linkname = ARR_AT(
+                VAL_ACT_DETAILS(item), IDX_TCC_NATIVE_LINKNAME
+            );
+            if (IS_TEXT(linkname))
+                rebElide("append", taken, KNOWN(linkname), rebEND);
+        }
+
         DECLARE_MOLD (mo);  // Note: mold buffer is UTF-8
         Push_Mold(mo);
 
-        RELVAL *item;
         for (item = VAL_ARRAY_AT(compilables); NOT_END(item); ++item) {
             if (IS_ACTION(item)) {
                 assert(Is_User_Native(VAL_ACTION(item)));
@@ -542,9 +684,19 @@ REBNATIVE(compile_p)
                 //
                 // https://forum.rebol.info/t/817
                 //
+                REBVAL *name;
+                if (IS_TEXT(linkname))
+                    name = rebValue("copy", KNOWN(linkname), rebEND);
+                else {
+                    assert(IS_BLANK(linkname));
+                    name = Auto_Linkname_Helper(DSP - dsp_orig, taken);
+                }
+                rebElide("append", linknames, name, rebEND);
+
                 Append_Ascii(mo->series, "const REBVAL *");
-                Append_String(mo->series, linkname, VAL_LEN_AT(linkname));
+                Append_String(mo->series, name, VAL_LEN_AT(name));
                 Append_Ascii(mo->series, "(void *frame_)\n{");
+                rebRelease(name);
 
                 Append_String(mo->series, source, VAL_LEN_AT(source));
 
@@ -575,23 +727,46 @@ REBNATIVE(compile_p)
         // this is similar in spirit to the -E option for preprocessing only)
         //
         if (REF(inspect)) {
+            rebRelease(taken);
+            rebRelease(linknames);
             DROP_GC_GUARD(handle);
             DS_DROP_TO(dsp_orig); // don't modify the collected user natives
             return Init_Text(D_OUT, Pop_Molded_String(mo));
         }
 
-        if (
-            tcc_compile_string(
-                state,
-                cs_cast(BIN_AT(SER(mo->series), mo->offset))
-            ) < 0
-        ){
-            rebJumps ("fail [",
-                "{TCC failed to compile the code}", compilables,
-            "]", rebEND);
+        bool cached = (
+            output_type == TCC_OUTPUT_MEMORY
+            and rebDid("pick", config, "'cache-dir", rebEND)
+        );
+
+        if (cached) {
+            //
+            // The cache has to call back into the evaluator (file I/O) which
+            // may use the mold buffer, so copy the source out of it first.
+            //
+            REBVAL *source = rebSizedBinary(
+                BIN_AT(SER(mo->series), mo->offset),
+                STR_SIZE(mo->series) - mo->offset
+            );
+            Drop_Mold(mo);
+
+            Compile_Via_Cache_Helper(state, config, source);
+            rebRelease(source);
         }
+        else {
+            if (
+                tcc_compile_string(
+                    state,
+                    cs_cast(BIN_AT(SER(mo->series), mo->offset))
+                ) < 0
+            ){
+                rebJumps ("fail [",
+                    "{TCC failed to compile the code}", compilables,
+                "]", rebEND);
+            }
 
-        Drop_Mold(mo);  // discard the combined source (no longer needed)
+            Drop_Mold(mo);  // discard the combined source (no longer needed)
+        }
     }
 
     // We could export just one symbol ("RL" for the Ext_Lib RL_LIB table) and
@@ -653,17 +828,19 @@ REBNATIVE(compile_p)
         assert(IS_ACTION(native) and Is_User_Native(VAL_ACTION(native)));
 
         REBARR *details = VAL_ACT_DETAILS(native);
-        REBVAL *linkname = KNOWN(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME));
 
-        char *name_utf8 = rebSpell("ensure text!", linkname, rebEND);
-        void *sym = tcc_get_symbol(state, name_utf8);
-        rebFree(name_utf8);
+        char *name_utf8 = rebSpell(
+            "pick", linknames, rebI(DSP - dsp_orig),
+        rebEND);
 
+        void *sym = tcc_get_symbol(state, name_utf8);
         if (not sym)
             rebJumps ("fail [",
-                "{TCC failed to find symbol:}", linkname,
+                "{TCC failed to find symbol:}", rebT(name_utf8),
             "]", rebEND);
 
+        rebFree(name_utf8);
+
         // Circumvent ISO C++ forbidding cast between function/data pointers
         //
         REBNAT c_func;
@@ -676,6 +853,9 @@ REBNATIVE(compile_p)
         DS_DROP();
     }
 
+    rebRelease(taken);
+    rebRelease(linknames);
+
     DROP_GC_GUARD(handle);
 
     return nullptr;
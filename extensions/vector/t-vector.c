@@ -640,6 +640,7 @@ REBTYPE(Vector)
     case SYM_COPY: {
         INCLUDE_PARAMS_OF_COPY;
         UNUSED(PAR(value));  // same as `v`
+        UNUSED(REF(share));
 
         if (REF(part) or REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
@@ -45,6 +45,186 @@ idate-to-date: function [return: [date!] date [text!]] [
     to date! unspaced [day "-" month "-" year "/" time zone]
 ]
 
+; Connections whose response was complete (and which the server didn't say
+; it would close) are kept open after the HTTP port is closed, and are then
+; used by the next request to the same scheme, host and port.  This saves a
+; TCP connect--and for HTTPS, a TLS handshake--on every request to a host.
+; The limits and statistics are in SYSTEM/SCHEMES/HTTP/POOL.
+;
+; An idle connection has a READ pending so that a close by the server (or
+; anything else arriving) evicts it from the pool.  But that close is only
+; seen if events are processed while the connection is idle, so a pooled
+; connection can still be OPEN? after the server has dropped it.  So a GET,
+; HEAD, PUT, DELETE, OPTIONS or TRACE (which are idempotent) that fails on a
+; pooled connection before any response arrives is retried, once, on a new
+; one.  The idle timeout is kept below common server keep-alive timeouts
+; (Apache's default is 5 seconds) to make that rare.
+;
+http-pool: make object! [
+    max-per-host: 4  ; idle connections kept for a scheme, host and port
+    max-idle: 32  ; idle connections kept in all
+    idle-timeout: 0:00:04  ; connections idle this long are closed
+
+    hits: 0  ; requests that used a pooled connection
+    misses: 0  ; requests that had to open a new connection
+    evictions: 0  ; idle connections closed for limits, timeouts or events
+
+    idle: copy []  ; [key connection time ...] with the oldest first
+]
+
+pool-key: func [return: [text!] spec [object!]] [
+    unspaced [spec/scheme "://" spec/host ":" spec/port-id]
+]
+
+pool-evict: func [
+    return: <void>
+    pos [block!] "Position of an entry in POOL/IDLE"
+    <local> conn
+][
+    conn: pos/2
+    remove/part pos 3
+    http-pool/evictions: http-pool/evictions + 1
+    conn/awake: _
+    attempt [close conn]  ; may already have been closed by the server
+]
+
+pool-awake: function [return: [logic!] event [event!]] [
+    if pos: find http-pool/idle event/port [pool-evict back pos]
+    false
+]
+
+pool-take: function [
+    {Get an idle connection to the host of a port's spec, if any}
+
+    return: [<opt> port!]
+    spec [object!]
+][
+    key: pool-key spec
+    pos: http-pool/idle
+    while [not tail? pos] [
+        any [
+            http-pool/idle-timeout < difference now/precise pos/3
+            not open? pos/2
+        ] then [
+            pool-evict pos
+            continue
+        ]
+        if key = pos/1 [
+            conn: pos/2
+            remove/part pos 3
+            http-pool/hits: http-pool/hits + 1
+            return conn
+        ]
+        pos: skip pos 3
+    ]
+    http-pool/misses: http-pool/misses + 1
+    return null
+]
+
+pool-put: function [
+    {Keep a connection for later use, or close it if the pool is full}
+
+    return: <void>
+    spec [object!]
+    conn [port!]
+][
+    key: pool-key spec
+    n: 0
+    for-each [k c t] http-pool/idle [if k = key [n: n + 1]]
+    if n >= http-pool/max-per-host [
+        if pos: find http-pool/idle key [pool-evict pos]
+    ]
+    if (length of http-pool/idle) >= (3 * http-pool/max-idle) [
+        if not empty? http-pool/idle [pool-evict http-pool/idle]
+    ]
+
+    if (http-pool/max-per-host > 0) and [http-pool/max-idle > 0] [
+        conn/awake: :pool-awake
+        conn/locals: _
+        append http-pool/idle reduce [key conn now/precise]
+        read conn
+    ] else [
+        conn/awake: _
+        close conn
+    ]
+]
+
+retryable?: function [
+    {Can a port's request be sent again on a new connection if it failed?}
+
+    return: [logic!]
+    port [port!]
+][
+    did all [
+        port/state/reused  ; a new connection failing is a real error
+        word? port/spec/method
+        find [get head put delete options trace] port/spec/method
+    ]
+]
+
+open-connection: function [
+    {Start opening a new TCP (or TLS) connection for an HTTP port}
+
+    return: <void>
+    port [port!]
+][
+    port/state/connection: conn: make port! compose [
+        scheme: (
+            either port/spec/scheme = 'http [lit 'tcp][lit 'tls]
+        )
+        host: port/spec/host
+        port-id: port/spec/port-id
+        ref: join-all [tcp:// host ":" port-id]
+    ]
+    conn/awake: :http-awake
+    conn/locals: port
+    open conn
+]
+
+retry-request: function [
+    {Drop a port's failed pooled connection, redo the request on a new one}
+
+    return: <void>
+    port [port!]
+][
+    net-log/C "Pooled connection failed, retrying on a new connection"
+    state: port/state
+    state/reused: no  ; only retry once
+    conn: state/connection
+    conn/awake: _
+    attempt [close conn]
+    state/state: 'retrying  ; http-awake does the request on CONNECT
+    open-connection port
+]
+
+reusable?: function [
+    {Can the connection used for a port's request be used for another?}
+
+    return: [logic!]
+    port [port!]
+][
+    state: port/state
+    info: state/info
+    headers: info/headers
+    did all [
+        state/state = 'ready
+        open? state/connection
+        text? info/response-line
+        find/match info/response-line "HTTP/1.1"
+        object? headers
+        not all [
+            text? connection: select headers 'connection
+            find connection "close"
+        ]
+        any [  ; body didn't have to be delimited by the server closing
+            port/spec/method = 'HEAD
+            find [no-content not-modified] info/response-parsed
+            integer? headers/content-length
+            headers/transfer-encoding = "chunked"
+        ]
+    ]
+]
+
 sync-op: function [port body] [
     if not port/state [
         open port
@@ -126,10 +306,26 @@ http-awake: function [return: [logic!] event [event!]] [
             false
         ]
         'connect [
+            if state/state = 'retrying [  ; new connection, see RETRY-REQUEST
+                do-request http-port
+                return false
+            ]
             state/state: 'ready
-            awake make event! [type: 'connect port: http-port]
+            res: awake make event! [type: 'connect port: http-port]
+
+            ; If the request failed and moved to a new connection, a WAIT on
+            ; the old one has to return (to wait on the new one instead).
+            ;
+            either state/state = 'retrying [true] [res]
         ]
         'close [
+            all [
+                find [doing-request reading-headers] state/state
+                retryable? http-port
+            ] then [
+                retry-request http-port
+                return true  ; as above, a WAIT on this connection must end
+            ]
             res: try switch state/state [
                 'ready [
                     awake make event! [type: 'close port: http-port]
@@ -191,7 +387,7 @@ make-http-request: func [
     result: unspaced [
         uppercase form method space
         either file? target [next mold target] [target]
-        space "HTTP/1.0" CR LF
+        space "HTTP/1.1" CR LF
     ]
     for-each [word string] headers [
         append result unspaced [mold word space string CR LF]
@@ -228,12 +424,19 @@ do-request: function [
         User-Agent: "REBOL"
     ] spec/headers
     port/state/state: 'doing-request
+    port/state/chunk-pending: 0
     info/headers: info/response-line: info/response-parsed: port/data:
     info/size: info/date: info/name: blank
-    write port/state/connection
     req: make-http-request spec/method any [spec/path %/]
-    spec/headers spec/content
+        spec/headers spec/content
     net-log/C to text! req
+
+    ; A pooled connection the server has reset fails here, not with a CLOSE.
+    ;
+    trap [write port/state/connection req] then (lambda e [
+        if not retryable? port [fail e]
+        retry-request port
+    ])
 ]
 
 ; if a no-redirect keyword is found in the write dialect after 'headers then
@@ -306,7 +509,7 @@ check-response: function [port] [
         if headers/last-modified [
             info/date: try attempt [idate-to-date headers/last-modified]
         ]
-        remove/part conn/data d2
+        consume conn d2  ; moves index, buffer space reclaimed by READ
         state/state: 'reading-data
         if lit (txt) <> last body-of :net-log [ ; net-log is in active state
             print "Dumping Webserver headers and body"
@@ -566,48 +769,31 @@ check-data: function [
 
     case [
         headers/transfer-encoding = "chunked" [
-            data: conn/data
             port/data: default [  ; only clear at request start
-                make binary! length of data
-            ]
-            out: port/data
-
-            while [parse data [
-                copy chunk-size some hex-digits thru crlfbin mk1: to end
-            ]][
-                ; The chunk size is in the byte stream as ASCII chars
-                ; forming a hex string.  ISSUE! can decode that.
-                chunk-size: (
-                    to-integer/unsigned to issue! to text! chunk-size
-                )
-
-                if chunk-size = 0 [
-                    parse mk1 [
-                        crlfbin (trailer: "") to end
-                            |
-                        copy trailer to crlf2bin to end
-                    ] then [
-                        trailer: construct/only trailer
-                        append headers body-of trailer
-                        state/state: 'ready
-                        res: state/awake make event! [
-                            type: 'custom
-                            port: port
-                            code: 0
-                        ]
-                        clear data
-                    ]
-                    break
-                ]
-                else [
-                    parse mk1 [chunk-size skip mk2: crlfbin to end] else [
-                        break
-                    ]
+                make binary! length of conn/data
+            ]
 
-                    insert/part tail of out mk1 mk2
-                    remove/part data skip mk2 2
-                    empty? data
+            ; DECODE-CHUNKED takes all of the body that has arrived, even
+            ; part of a chunk.  It returns how much of that chunk is still to
+            ; come (to be passed back in on the next read), or the trailer
+            ; once the last chunk is seen.
+            ;
+            trailer: decode-chunked port/data conn state/chunk-pending
+            if integer? trailer [
+                state/chunk-pending: trailer
+            ] else [
+                state/chunk-pending: 0
+                if not empty? trailer [
+                    trailer: construct/only trailer
+                    append headers body-of trailer
                 ]
+                state/state: 'ready
+                res: state/awake make event! [
+                    type: 'custom
+                    port: port
+                    code: 0
+                ]
+                clear conn/data
             ]
 
             if state/state <> 'ready [
@@ -643,7 +829,6 @@ check-data: function [
     return res
 ]
 
-hex-digits: charset "1234567890abcdefABCDEF"
 sys/make-scheme [
     name: 'http
     title: "HyperText Transport Protocol v1.1"
@@ -658,6 +843,8 @@ sys/make-scheme [
         follow: 'redirect
     ]
 
+    pool: http-pool  ; connection pool limits and statistics
+
     info: make system/standard/file-info [
         response-line:
         response-parsed:
@@ -737,22 +924,29 @@ sys/make-scheme [
             port/state: make object! [
                 state: 'inited
                 connection: _
+                chunk-pending: 0  ; see DECODE-CHUNKED
                 error: _
                 close?: no
+                reused: no  ; connection came from the pool (see RETRY-REQUEST)
                 info: make port/scheme/info [type: 'file]
                 awake: ensure [action! blank!] :port/awake
             ]
-            port/state/connection: conn: make port! compose [
-                scheme: (
-                    either port/spec/scheme = 'http [lit 'tcp][lit 'tls]
-                )
-                host: port/spec/host
-                port-id: port/spec/port-id
-                ref: join-all [tcp:// host ":" port-id]
-            ]
-            conn/awake: :http-awake
-            conn/locals: port
-            open conn
+            if conn: pool-take port/spec [
+                port/state/connection: conn
+                port/state/reused: yes
+                conn/awake: :http-awake
+                conn/locals: port
+
+                ; Already connected, so there's no CONNECT event coming to
+                ; start the request...fake one.
+                ;
+                insert system/ports/system make event! [
+                    type: 'connect
+                    port: conn
+                ]
+                return port
+            ]
+            open-connection port
             port
         ]
 
@@ -772,8 +966,12 @@ sys/make-scheme [
             port [port!]
         ][
             if port/state [
-                close port/state/connection
-                port/state/connection/awake: _
+                either reusable? port [
+                    pool-put port/spec port/state/connection
+                ][
+                    close port/state/connection
+                    port/state/connection/awake: _
+                ]
                 port/state: _
             ]
             port
@@ -815,6 +1013,7 @@ sys/make-scheme [
 sys/make-scheme/with [
     name: 'https
     title: "Secure HyperText Transport Protocol v1.1"
+    pool: http-pool  ; same pool (the scheme is part of the key)
     spec: make spec [
         port-id: 443
     ]
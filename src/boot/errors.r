@@ -73,6 +73,7 @@ Syntax: [
     no-header:          [{script is missing a REBOL header:} :arg1]
     bad-header:         [{script header is not valid:} :arg1]
     bad-compress:       [{compressed script body is not valid:} :arg1]
+    bad-serial:         [{invalid SAVE/BINARY data:} :arg1]
     malconstruct:       [{invalid construction spec:} :arg1]
     bad-char:           [{invalid character in:} :arg1]
     needs:              [{this script needs} :arg1 :arg2 {or better to run correctly}]
@@ -208,6 +209,8 @@ Script: [
     bad-library:        {bad library (already closed?)}
     only-callback-ptr:  {Only callback functions may be passed by FFI pointer}
     free-needs-routine: {Function to destroy struct storage must be routine}
+    bad-routine-arg:    [{routine can't take} :arg1 {for its} :arg2 {argument}]
+    bad-batch-call:     [{ROUTINE-BATCH call} :arg1 {failed:} :arg2]
 
     block-skip-wrong:   {Block is not even multiple of skip size}
 
@@ -289,6 +289,7 @@ copy: generic [
     /deep "Also copies series values within the block"
     /types "What datatypes to copy"
         [typeset! datatype!]
+    /share "Defer copying large data until the copy or original is changed"
 ]
 
 take*: generic [
@@ -316,6 +316,11 @@ standard: make object! [
         ; be a field only in those TCP listening ports...
         ;
         connections:
+
+        ; INTEGER! count of events the System Port has dispatched to this
+        ; port (whether it has an AWAKE or not), for monitoring busy ports.
+        ;
+        events:
             _
     ]
 
@@ -421,6 +421,27 @@ zlib
 gzip
 detect
 
+; strategies for DEFLATE (DEFAULT is also one)
+;
+filtered
+huffman-only
+rle
+fixed
+
+; filters for RESIZE-IMAGE in the IMAGE! extension
+;
+nearest
+bilinear
+lanczos
+
+; row filters for ENCODE-PNG/FILTER in the PNG extension (plus NONE)
+;
+sub
+up
+average
+paeth
+minsum
+
 ; REFLECT needs a SYM_XXX values at the moment, because it uses the dispatcher
 ; Generic_Dispatcher() vs. there being a separate one just for REFLECT.
 ; But it's not a type action, it's a native in order to be faster and also
@@ -1192,6 +1192,48 @@ unsigned char *RL_rebBytes(
 }
 
 
+struct Reb_Api_Mold_Sink {
+    REBSNK *sink;
+    void *opaque;
+};
+
+static void Api_Mold_Sink(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size)
+{
+    struct Reb_Api_Mold_Sink *api = cast(
+        struct Reb_Api_Mold_Sink*, mo->sink_data
+    );
+    (*api->sink)(utf8, size, api->opaque);
+}
+
+
+//
+//  rebMoldSink: RL_API
+//
+// MOLD a value without building the whole result in memory.  The UTF-8 is
+// passed to `sink` in chunks as it is produced, so a very large structure can
+// be streamed to a file or socket with constant overhead.
+//
+// The bytes are only valid during the callback, and it must copy them before
+// calling any API that might mold (e.g. rebSizedBinary() first, if the chunk
+// is to be handed to Rebol code).
+//
+void RL_rebMoldSink(REBSNK *sink, void *opaque, const REBVAL *v)
+{
+    struct Reb_Api_Mold_Sink api;
+    api.sink = sink;
+    api.opaque = opaque;
+
+    DECLARE_MOLD (mo);
+    mo->sink = &Api_Mold_Sink;
+    mo->sink_data = &api;
+
+    Push_Mold(mo);
+    Mold_Value(mo, v);
+    Flush_Mold(mo);
+    Drop_Mold(mo);
+}
+
+
 //=//// EXCEPTION HANDLING ////////////////////////////////////////////////=//
 //
 // There API is approaching exception handling with three different modes.
@@ -1637,7 +1679,9 @@ void *RL_rebDeflateAlloc(
     size_t in_len
 ){
     REBSTR *envelope = Canon(SYM_NONE);
-    return Compress_Alloc_Core(out_len, input, in_len, envelope);
+    return Compress_Alloc_Core(
+        out_len, input, in_len, envelope, -1, nullptr, 0
+    );
 }
 
 
@@ -1653,7 +1697,9 @@ void *RL_rebZdeflateAlloc(
     size_t in_len
 ){
     REBSTR *envelope = Canon(SYM_ZLIB);
-    return Compress_Alloc_Core(out_len, input, in_len, envelope);
+    return Compress_Alloc_Core(
+        out_len, input, in_len, envelope, -1, nullptr, 0
+    );
 }
 
 
@@ -1669,7 +1715,9 @@ void *RL_rebGzipAlloc(
     size_t in_len
 ){
     REBSTR *envelope = nullptr; // see notes in Gunzip on why GZIP is default
-    return Compress_Alloc_Core(out_len, input, in_len, envelope);
+    return Compress_Alloc_Core(
+        out_len, input, in_len, envelope, -1, nullptr, 0
+    );
 }
 
 
@@ -29,6 +29,50 @@
 #include "sys-core.h"
 
 
+//
+//  Expand_Binder: C
+//
+// Double the number of slots in a binder's side table, rehashing the entries
+// into an unmanaged series (so a fail() in mid-bind will free it).
+//
+void Expand_Binder(struct Reb_Binder *binder)
+{
+    REBLEN old_num_slots = BINDER_NUM_SLOTS(binder);
+    struct Reb_Binder_Entry *old_slots = binder->slots;
+    REBSER *old_table = binder->table;
+
+    if (binder->shift == 1)
+        fail ("Too many words for binding table");  // 2^31 slots
+
+    --binder->shift;
+    REBLEN num_slots = BINDER_NUM_SLOTS(binder);
+    REBLEN mask = num_slots - 1;
+
+    binder->table = Make_Series_Core(
+        num_slots,
+        sizeof(struct Reb_Binder_Entry),
+        SERIES_FLAG_FIXED_SIZE
+    );
+    binder->slots = SER_HEAD(struct Reb_Binder_Entry, binder->table);
+    memset(binder->slots, 0, num_slots * sizeof(struct Reb_Binder_Entry));
+
+    REBLEN old_slot;
+    for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
+        REBSTR *canon = old_slots[old_slot].canon;
+        if (not canon)
+            continue;
+
+        REBLEN slot = Binder_Home_Slot(binder, canon);
+        while (binder->slots[slot].canon)
+            slot = (slot + 1) & mask;
+        binder->slots[slot] = old_slots[old_slot];
+    }
+
+    if (old_table)
+        Free_Unmanaged_Series(old_table);
+}
+
+
 //
 //  Bind_Values_Inner_Loop: C
 //
@@ -85,7 +129,7 @@ void Bind_Values_Inner_Loop(
         ){
             Bind_Values_Inner_Loop(
                 binder,
-                VAL_ARRAY_AT(cell),
+                VAL_ARRAY_AT_UNSHARED(cell),
                 context,
                 bind_types,
                 add_midstream_types,
@@ -159,7 +203,7 @@ void Unbind_Values_Core(RELVAL *head, REBCTX *context, bool deep)
             Unbind_Any_Word(v);
         }
         else if (ANY_ARRAY_OR_PATH(v) and deep)
-            Unbind_Values_Core(VAL_ARRAY_AT(v), context, true);
+            Unbind_Values_Core(VAL_ARRAY_AT_UNSHARED(v), context, true);
     }
 }
 
@@ -312,7 +356,9 @@ void Rebind_Values_Deep(
     RELVAL *v = head;
     for (; NOT_END(v); ++v) {
         if (ANY_ARRAY_OR_PATH(v)) {
-            Rebind_Values_Deep(src, dst, VAL_ARRAY_AT(v), opt_binder);
+            Rebind_Values_Deep(
+                src, dst, VAL_ARRAY_AT_UNSHARED(v), opt_binder
+            );
         }
         else if (ANY_WORD(v) and VAL_BINDING(v) == NOD(src)) {
             INIT_BINDING(v, dst);
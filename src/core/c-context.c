@@ -369,50 +369,40 @@ REBARR *Grab_Collected_Array_Managed(
 //
 //  Collect_End: C
 //
-// Reset the bind markers in the canon series nodes so they can be reused,
-// and empty the BUF_COLLECT.
+// Remove the collected words from the collector's binder, and empty the
+// BUF_COLLECT.
+//
+// If an error interrupts a collect, this is called with no collector just to
+// reset the BUF_COLLECT.  The binder's side table needs no cleanup in that
+// case--if it grew into a series, the trap frees that as an unmanaged one.
 //
 void Collect_End(struct Reb_Collector *cl)
 {
+    if (cl == NULL) {
+        SET_ARRAY_LEN_NOTERM(BUF_COLLECT, 0);
+        return;
+    }
+
     // We didn't terminate as we were collecting, so terminate now.
     //
     TERM_ARRAY_LEN(BUF_COLLECT, ARR_LEN(BUF_COLLECT));
 
     // Reset binding table (note BUF_COLLECT may have expanded)
     //
-    RELVAL *v =
-        (cl == NULL or (cl->flags & COLLECT_AS_TYPESET))
-            ? ARR_HEAD(BUF_COLLECT) + 1
-            : ARR_HEAD(BUF_COLLECT);
+    RELVAL *v = (cl->flags & COLLECT_AS_TYPESET)
+        ? ARR_HEAD(BUF_COLLECT) + 1
+        : ARR_HEAD(BUF_COLLECT);
     for (; NOT_END(v); ++v) {
-        REBSTR *canon =
-            (cl == NULL or (cl->flags & COLLECT_AS_TYPESET))
-                ? VAL_KEY_CANON(v)
-                : VAL_WORD_CANON(v);
-
-        if (cl != NULL) {
-            Remove_Binder_Index(&cl->binder, canon);
-            continue;
-        }
+        REBSTR *canon = (cl->flags & COLLECT_AS_TYPESET)
+            ? VAL_KEY_CANON(v)
+            : VAL_WORD_CANON(v);
 
-        // !!! This doesn't have a "binder" available to clear out the
-        // keys with.  The nature of handling error states means that if
-        // a thread-safe binding system was implemented, we'd have to know
-        // which thread had the error to roll back any binding structures.
-        // For now just zero it out based on the collect buffer.
-        //
-        assert(
-            MISC(canon).bind_index.high != 0
-            or MISC(canon).bind_index.low != 0
-        );
-        MISC(canon).bind_index.high = 0;
-        MISC(canon).bind_index.low = 0;
+        Remove_Binder_Index(&cl->binder, canon);
     }
 
     SET_ARRAY_LEN_NOTERM(BUF_COLLECT, 0);
 
-    if (cl != NULL)
-        SHUTDOWN_BINDER(&cl->binder);
+    SHUTDOWN_BINDER(&cl->binder);
 }
 
 
@@ -793,6 +783,28 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
         COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
     );
 
+    return Make_Selfish_Context_For_Keylist(
+        kind,
+        keylist,
+        self_index,
+        opt_parent
+    );
+}
+
+
+//
+//  Make_Selfish_Context_For_Keylist: C
+//
+// Second half of Make_Selfish_Context_Detect_Managed(), once the keylist is
+// known (which may be a keylist shared by objects made from the same body,
+// see Make_Selfish_Context_Memoized_Managed()).
+//
+REBCTX *Make_Selfish_Context_For_Keylist(
+    enum Reb_Kind kind,
+    REBARR *keylist,
+    REBLEN self_index,
+    REBCTX *opt_parent
+){
     REBLEN len = ARR_LEN(keylist);
     REBARR *varlist = Make_Array_Core(
         len,
@@ -810,7 +822,10 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     // obvious what's going on.
     //
     if (opt_parent == NULL) {
-        INIT_CTX_KEYLIST_UNIQUE(context, keylist);
+        if (GET_SERIES_INFO(keylist, KEYLIST_SHARED))
+            INIT_CTX_KEYLIST_SHARED(context, keylist);  // memoized
+        else
+            INIT_CTX_KEYLIST_UNIQUE(context, keylist);
         LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
     }
     else {
@@ -879,6 +894,140 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
 }
 
 
+// Programs often make many objects from the same body, e.g. a record
+// template in a loop: `loop 1000 [append records make object! [a: 1 b: 2]]`.
+// Collecting the keys from the body again each time needs a binder, a pass
+// over the body, and a new keylist.  So the keylists of bodies made without
+// a parent are remembered in a small cache, keyed by the body's array and
+// index, and shared by all the objects made from that body.
+//
+// Arrays are mutable, so a hit is checked by walking the body's SET-WORD!s
+// against the keys (cheap compared to collecting).  Entries whose array or
+// keylist weren't marked are dropped by the GC before it sweeps.
+//
+#define KEYLIST_CACHE_SHIFT 26  // 32 - 6, so 2^6 entries
+#define KEYLIST_CACHE_SIZE 64
+
+static struct {
+    REBARR *array;  // nullptr if entry unused
+    REBLEN index;
+    REBARR *keylist;
+} Keylist_Cache[KEYLIST_CACHE_SIZE];
+
+
+//
+//  Keylist_Matches_Body: C
+//
+// Would collecting the SET-WORD!s of this body (with no parent) produce a
+// keylist with the same keys as this one?  Bodies with duplicate SET-WORD!s
+// or a `self:` never match, and just don't get memoized.
+//
+static bool Keylist_Matches_Body(REBARR *keylist, const RELVAL *head)
+{
+    REBLEN len = ARR_LEN(keylist);
+    if (len < 2 or VAL_KEY_SYM(KNOWN(ARR_AT(keylist, 1))) != SYM_SELF)
+        return false;
+
+    REBLEN n = 2;
+    for (; NOT_END(head); ++head) {
+        const REBCEL *cell = VAL_UNESCAPED(head);  // as Collect_Inner_Loop()
+        if (CELL_KIND(cell) != REB_SET_WORD)
+            continue;
+
+        if (n == len)
+            return false;
+        if (VAL_WORD_CANON(cell) != VAL_KEY_CANON(KNOWN(ARR_AT(keylist, n))))
+            return false;
+        ++n;
+    }
+
+    return n == len;
+}
+
+
+//
+//  Make_Selfish_Context_Memoized_Managed: C
+//
+// Same as Make_Selfish_Context_Detect_Managed() with no parent, for a body
+// which is at an index in an array--but reusing the keylist of the last
+// object made from that same body if the body's SET-WORD!s haven't changed.
+//
+REBCTX *Make_Selfish_Context_Memoized_Managed(
+    enum Reb_Kind kind,
+    REBARR *array,
+    REBLEN index
+){
+    const RELVAL *head = ARR_AT(array, index);
+
+    uint32_t bits = cast(uint32_t, cast(uintptr_t, array) >> 3);
+    REBLEN slot = cast(uint32_t, (bits + index) * 2654435769u)
+        >> KEYLIST_CACHE_SHIFT;
+
+    REBARR *keylist;
+    if (
+        Keylist_Cache[slot].array == array
+        and Keylist_Cache[slot].index == index
+        and Keylist_Matches_Body(Keylist_Cache[slot].keylist, head)
+    ){
+        keylist = Keylist_Cache[slot].keylist;
+    }
+    else {
+        REBLEN self_index;
+        keylist = Collect_Keylist_Managed(
+            &self_index,
+            head,
+            nullptr,
+            COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
+        );
+        assert(self_index == 1);
+
+        if (Keylist_Matches_Body(keylist, head)) {
+            //
+            // Flag the keylist as shared now, so that the first object made
+            // with it copies it before adding fields, like all the others.
+            //
+            SET_SERIES_INFO(keylist, KEYLIST_SHARED);
+
+            Keylist_Cache[slot].array = array;
+            Keylist_Cache[slot].index = index;
+            Keylist_Cache[slot].keylist = keylist;
+        }
+    }
+
+    const REBLEN self_index = 1;
+    return Make_Selfish_Context_For_Keylist(
+        kind,
+        keylist,
+        self_index,
+        nullptr
+    );
+}
+
+
+//
+//  Prune_Keylist_Cache: C
+//
+// Called by the GC after marking, so entries don't outlive their arrays.
+//
+void Prune_Keylist_Cache(void)
+{
+    REBLEN slot;
+    for (slot = 0; slot < KEYLIST_CACHE_SIZE; ++slot) {
+        if (not Keylist_Cache[slot].array)
+            continue;
+
+        REBSER *array = SER(Keylist_Cache[slot].array);
+        REBSER *keylist = SER(Keylist_Cache[slot].keylist);
+        if (
+            not (array->header.bits & NODE_FLAG_MARKED)
+            or not (keylist->header.bits & NODE_FLAG_MARKED)
+        ){
+            Keylist_Cache[slot].array = nullptr;
+        }
+    }
+}
+
+
 //
 //  Construct_Context_Managed: C
 //
@@ -1281,32 +1430,110 @@ void Resolve_Context(
 }
 
 
+//
+//  Make_Keyhash_Managed: C
+//
+// Build the lookup table for a keylist's canon spellings.  Slot [0] holds the
+// number of keys it covers (keylists of unique contexts can be extended in
+// place, and then the table must be rebuilt).  The remaining slots are an
+// open hash of key indices, using the spelling hash cached on the canons.
+//
+// A canon may be GC'd and a synonym take its place, but the synonym inherits
+// the hash...so the table stays valid, with hits checked by canon compare.
+//
+static REBSER *Make_Keyhash_Managed(REBARR *keylist)
+{
+    REBLEN len = ARR_LEN(keylist) - 1;  // don't count the rootkey
+
+    REBLEN num_slots = MIN_KEYS_FOR_KEYHASH * 2;
+    while (num_slots < len * 2)
+        num_slots *= 2;
+    REBLEN mask = num_slots - 1;
+
+    REBSER *s = Make_Series_Core(
+        num_slots + 1,
+        sizeof(REBLEN),
+        SERIES_FLAG_FIXED_SIZE
+    );
+    REBLEN *slots = SER_HEAD(REBLEN, s);
+    memset(slots, 0, (num_slots + 1) * sizeof(REBLEN));
+    SET_SERIES_LEN(s, num_slots + 1);
+
+    slots[0] = len;
+    ++slots;
+
+    REBVAL *key = KNOWN(ARR_AT(keylist, 1));
+    REBLEN n;
+    for (n = 1; n <= len; ++n, ++key) {
+        REBLEN slot = MISC(VAL_KEY_CANON(key)).hash & mask;
+        while (slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        slots[slot] = n;
+    }
+
+    return Manage_Series(s);
+}
+
+
 //
 //  Find_Canon_In_Context: C
 //
 // Search a context looking for the given canon symbol.  Return the index or
 // 0 if not found.
 //
+// Small contexts are searched linearly.  Larger object keylists get a hash
+// table on first search, which is then shared by every object with the same
+// keylist (e.g. all objects derived from a prototype without adding fields).
+//
 REBLEN Find_Canon_In_Context(REBCTX *context, REBSTR *canon, bool always)
 {
     assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-    REBVAL *key = CTX_KEYS_HEAD(context);
+    REBARR *keylist = CTX_KEYLIST(context);
     REBLEN len = CTX_LEN(context);
 
-    REBLEN n;
-    for (n = 1; n <= len; n++, key++) {
-        if (canon == VAL_KEY_CANON(key)) {
-            if (Is_Param_Unbindable(key)) {
-                if (not always)
-                    return 0;
+    REBLEN n = 0;
+    if (len < MIN_KEYS_FOR_KEYHASH or GET_ARRAY_FLAG(keylist, IS_PARAMLIST)) {
+        REBVAL *key = CTX_KEYS_HEAD(context);
+        REBLEN i;
+        for (i = 1; i <= len; ++i, ++key) {
+            if (canon == VAL_KEY_CANON(key)) {
+                n = i;
+                break;
+            }
+        }
+    }
+    else {
+        if (
+            NOT_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK)
+            or *SER_HEAD(REBLEN, MISC_KEYHASH(keylist)) != ARR_LEN(keylist) - 1
+        ){
+            MISC_KEYHASH_NODE(keylist) = NOD(Make_Keyhash_Managed(keylist));
+            SET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK);
+        }
+
+        REBSER *keyhash = MISC_KEYHASH(keylist);
+        REBLEN mask = SER_LEN(keyhash) - 2;
+        REBLEN *slots = SER_HEAD(REBLEN, keyhash) + 1;
+
+        REBLEN slot = MISC(canon).hash & mask;
+        REBLEN i;
+        while ((i = slots[slot]) != 0) {
+            if (i <= len and canon == VAL_KEY_CANON(CTX_KEY(context, i))) {
+                n = i;
+                break;
             }
-            return n;
+            slot = (slot + 1) & mask;
         }
     }
 
-    // !!! Should this be changed to NOT_FOUND?
-    return 0;
+    if (n == 0)
+        return 0;  // !!! Should this be changed to NOT_FOUND?
+
+    if (Is_Param_Unbindable(CTX_KEY(context, n)) and not always)
+        return 0;
+
+    return n;
 }
 
 
@@ -52,6 +52,10 @@ void Snap_State_Core(struct Reb_State *s)
     s->mold_buf_size = STR_SIZE(STR(MOLD_BUF));
     s->mold_loop_tail = ARR_LEN(TG_Mold_Stack);
 
+  #if !defined(NDEBUG)
+    s->num_binders = TG_Num_Binders;
+  #endif
+
     // !!! Is this initialization necessary?
     s->error = NULL;
 }
@@ -160,12 +164,15 @@ void Trapped_Helper(struct Reb_State *s)
     DS_DROP_TO(s->dsp);
 
     // If we were in the middle of a Collect_Keys and an error occurs, then
-    // the binding lookup table has entries in it that need to be zeroed out.
-    // We can tell if that's necessary by whether there is anything
-    // accumulated in the collect buffer.
+    // the collect buffer needs to be emptied.  (The collector's binder keeps
+    // its indices in a side table, so there is nothing to zero out.)
     //
     if (ARR_LEN(BUF_COLLECT) != 0)
-        Collect_End(NULL); // !!! No binder, review implications
+        Collect_End(NULL);
+
+  #if !defined(NDEBUG)
+    TG_Num_Binders = s->num_binders;
+  #endif
 
     // Free any manual series that were extant at the time of the error
     // (that were created since this PUSH_TRAP started).  This includes
@@ -560,7 +567,7 @@ REB_R MAKE_Error(
         Init_Error(out, error);
 
         Rebind_Context_Deep(root_error, error, NULL); // NULL=>no more binds
-        Bind_Values_Deep(VAL_ARRAY_AT(arg), error);
+        Bind_Values_Deep(VAL_ARRAY_AT_UNSHARED(arg), error);
 
         DECLARE_LOCAL (evaluated);
         if (Do_Any_Array_At_Throws(evaluated, arg, SPECIFIED)) {
@@ -0,0 +1,273 @@
+//
+//  File: %c-thread.c
+//  Summary: "Worker threads for natives that split up large work"
+//  Section: core
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The interpreter runs on one thread.  But a few natives do a lot of work on
+// plain memory that splits into independent tasks: the blocks of DEFLATE
+// /BLOCKS, the bands of ENCODE-PNG/BANDS, the rows of RESIZE-IMAGE.  Such a
+// native gathers what the tasks need into a C struct and calls Run_Tasks(),
+// which runs them on up to TASK-THREADS threads (counting the caller's) and
+// returns once all of them are done.
+//
+// A task must not touch the interpreter: no rebXXX() API calls, no fail(),
+// no making or freeing series, and no reading of cells.  It works only on the
+// memory it is pointed at, using malloc() if it needs to allocate, and it
+// records any error for the native to report once Run_Tasks() returns.
+//
+// The one exception is Intern_UTF8_Managed(), which tasks may call to look
+// up or make words.  Lookups don't lock, and the rest of it holds the lock of
+// Lock_Tasks() while it inserts into the symbol table and makes the symbol's
+// series.  (The interpreter's thread is inside Run_Tasks() doing tasks of its
+// own, so nothing else is using the memory pools then.)
+//
+// Threads are started for each Run_Tasks() rather than kept in a pool.  The
+// natives only split work that takes milliseconds, which makes the cost of
+// starting a thread small, and there is then nothing to shut down.  If a
+// thread can't be started, the ones that did (and the caller) take its share.
+//
+
+#include "sys-core.h"
+
+#if defined(TO_WINDOWS)
+    #undef IS_ERROR  // windows has its own meaning for this.
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+#elif !defined(TO_EMSCRIPTEN)
+    #define TASK_PTHREADS
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf()
+#endif
+
+#define MAX_TASK_THREADS 64
+
+#if defined(TO_WINDOWS)
+    static CRITICAL_SECTION Task_Lock;
+    static bool Task_Lock_Initialized = false;
+#elif defined(TASK_PTHREADS)
+    static pthread_mutex_t Task_Lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+struct Reb_Tasks {
+    TASK_CFUNC *task;
+    void *opaque;
+    REBLEN count;
+
+  #if defined(TO_WINDOWS)
+    volatile LONG next;
+  #elif defined(TASK_PTHREADS)
+    pthread_mutex_t lock;
+    REBLEN next;
+  #else
+    REBLEN next;
+  #endif
+};
+
+
+static REBLEN Claim_Task(struct Reb_Tasks *t)
+{
+  #if defined(TO_WINDOWS)
+    return cast(REBLEN, InterlockedIncrement(&t->next) - 1);
+  #elif defined(TASK_PTHREADS)
+    pthread_mutex_lock(&t->lock);
+    REBLEN n = t->next++;
+    pthread_mutex_unlock(&t->lock);
+    return n;
+  #else
+    return t->next++;
+  #endif
+}
+
+
+static void Run_Claimed_Tasks(struct Reb_Tasks *t)
+{
+    REBLEN n;
+    while ((n = Claim_Task(t)) < t->count)
+        (*t->task)(t->opaque, n);
+}
+
+
+#if defined(TO_WINDOWS)
+    static DWORD WINAPI Task_Thread(LPVOID opaque) {
+        Run_Claimed_Tasks(cast(struct Reb_Tasks*, opaque));
+        return 0;
+    }
+#elif defined(TASK_PTHREADS)
+    static void *Task_Thread(void *opaque) {
+        Run_Claimed_Tasks(cast(struct Reb_Tasks*, opaque));
+        return nullptr;
+    }
+#endif
+
+
+//
+//  Get_Task_Threads: C
+//
+// Most threads Run_Tasks() will use, counting the caller's.  Unless it has
+// been set with TASK-THREADS/LIMIT, this is the number of processors online.
+//
+REBLEN Get_Task_Threads(void)
+{
+    if (PG_Task_Threads == 0) {
+        REBINT cpus = 1;
+      #if defined(TO_WINDOWS)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        cpus = info.dwNumberOfProcessors;
+      #elif defined(TASK_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+      #endif
+        PG_Task_Threads = MIN(MAX(cpus, 1), MAX_TASK_THREADS);
+    }
+    return PG_Task_Threads;
+}
+
+
+//
+//  Lock_Tasks: C
+//
+// Serialize the interpreter routines tasks are allowed to call, which is only
+// Intern_UTF8_Managed() so far.  Outside of Run_Tasks() there is no thread
+// but the interpreter's, so this does nothing.  The routines must not fail()
+// while holding it, which they can only do (running out of memory) in a task,
+// where fail() is never allowed anyway.
+//
+void Lock_Tasks(void)
+{
+    if (not PG_Tasks_Running)
+        return;
+
+  #if defined(TO_WINDOWS)
+    EnterCriticalSection(&Task_Lock);
+  #elif defined(TASK_PTHREADS)
+    pthread_mutex_lock(&Task_Lock);
+  #endif
+}
+
+
+//
+//  Unlock_Tasks: C
+//
+void Unlock_Tasks(void)
+{
+    if (not PG_Tasks_Running)
+        return;
+
+  #if defined(TO_WINDOWS)
+    LeaveCriticalSection(&Task_Lock);
+  #elif defined(TASK_PTHREADS)
+    pthread_mutex_unlock(&Task_Lock);
+  #endif
+}
+
+
+//
+//  Run_Tasks: C
+//
+// Call `task(opaque, n)` for each n from 0 to `count - 1`, on as many as
+// Get_Task_Threads() threads, and return when all calls have returned.  The
+// tasks are claimed in order, so earlier ones tend to finish first.
+//
+void Run_Tasks(TASK_CFUNC *task, void *opaque, REBLEN count)
+{
+    struct Reb_Tasks t;
+    t.task = task;
+    t.opaque = opaque;
+    t.count = count;
+    t.next = 0;
+
+    REBLEN num_threads = MIN(Get_Task_Threads(), count);
+
+    assert(not PG_Tasks_Running);  // tasks can't run tasks of their own
+    PG_Tasks_Running = (num_threads > 1);  // (set before any thread starts)
+
+  #if defined(TO_WINDOWS)
+    if (PG_Tasks_Running and not Task_Lock_Initialized) {
+        InitializeCriticalSection(&Task_Lock);
+        Task_Lock_Initialized = true;
+    }
+
+    HANDLE threads[MAX_TASK_THREADS];
+    REBLEN started = 0;
+    for (; started + 1 < num_threads; ++started) {
+        threads[started] = CreateThread(
+            nullptr, 0, &Task_Thread, &t, 0, nullptr
+        );
+        if (threads[started] == nullptr)
+            break;  // the threads that did start take its share
+    }
+
+    Run_Claimed_Tasks(&t);
+
+    REBLEN i;
+    for (i = 0; i < started; ++i) {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+    }
+  #elif defined(TASK_PTHREADS)
+    pthread_mutex_init(&t.lock, nullptr);
+
+    pthread_t threads[MAX_TASK_THREADS];
+    REBLEN started = 0;
+    for (; started + 1 < num_threads; ++started) {
+        if (pthread_create(&threads[started], nullptr, &Task_Thread, &t) != 0)
+            break;  // the threads that did start take its share
+    }
+
+    Run_Claimed_Tasks(&t);
+
+    REBLEN i;
+    for (i = 0; i < started; ++i)
+        pthread_join(threads[i], nullptr);
+
+    pthread_mutex_destroy(&t.lock);
+  #else
+    UNUSED(num_threads);  // no threads on this platform, so all in order
+    Run_Claimed_Tasks(&t);
+  #endif
+
+    PG_Tasks_Running = false;  // (cleared after all the threads are joined)
+}
+
+
+//
+//  task-threads: native [
+//
+//  {Number of threads that natives may split large work across}
+//
+//      return: [integer!]
+//      /limit "Use at most this many (1 keeps all work on the main thread)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(task_threads)
+{
+    INCLUDE_PARAMS_OF_TASK_THREADS;
+
+    if (REF(limit)) {
+        REBINT limit = VAL_INT32(ARG(limit));
+        if (limit < 1)
+            fail (PAR(limit));
+        PG_Task_Threads = MIN(limit, MAX_TASK_THREADS);
+    }
+
+    return Init_Integer(D_OUT, Get_Task_Threads());
+}
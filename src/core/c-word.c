@@ -26,6 +26,13 @@
 // and are merely *indexed* by hashes of their canon forms via an external
 // table.  This table grows and shrinks as canons are added and removed.
 //
+// Tasks running on other threads under Run_Tasks() may intern words too (see
+// %c-thread.c).  A lookup of a spelling that is already interned takes no
+// lock: it probes whichever table was current when it started.  Only a miss
+// takes the lock of Lock_Tasks(), to search again and insert.  Growing the
+// table fills in a new one and publishes it, so lookups on other threads keep
+// going on the old one meanwhile--it is freed once no tasks are running.
+//
 
 #include "sys-core.h"
 
@@ -119,6 +126,51 @@ static REBSTR PG_Deleted_Canon;
 #define DELETED_CANON &PG_Deleted_Canon
 
 
+// Lookups don't lock, so the pointers they follow (the table, its slots, and
+// the links between synonyms) are written with release stores once what they
+// point to is complete, and read with acquire loads.
+//
+inline static void *Load_Acquire(void * const *p) {
+  #if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+  #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return *cast(void * const volatile*, p);  // acquire under /volatile:ms
+  #elif defined(_MSC_VER)
+    return _InterlockedCompareExchangePointer(
+        m_cast(void * volatile*, cast(void * const volatile*, p)),
+        nullptr,
+        nullptr
+    );
+  #else
+    return *cast(void * const volatile*, p);  // no threads, see %c-thread.c
+  #endif
+}
+
+inline static void Store_Release(void **p, void *v) {
+  #if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+  #elif defined(_MSC_VER)
+    _InterlockedExchangePointer(cast(void * volatile*, p), v);
+  #else
+    *cast(void * volatile*, p) = v;
+  #endif
+}
+
+
+// Tables that were replaced while tasks might still be probing them.  There
+// can't be more of these than sizes of table.
+//
+static REBSER *Retired_Word_Tables[sizeof(Primes) / sizeof(Primes[0])];
+static REBLEN Num_Retired_Word_Tables = 0;
+
+static void Free_Retired_Word_Tables(void)
+{
+    assert(not PG_Tasks_Running);
+    while (Num_Retired_Word_Tables != 0)
+        Free_Unmanaged_Series(Retired_Word_Tables[--Num_Retired_Word_Tables]);
+}
+
+
 //
 //  Expand_Word_Table: C
 //
@@ -126,6 +178,11 @@ static REBSTR PG_Deleted_Canon;
 // the next larger table size and rehashing all the words of
 // the current table.  Free the old hash array.
 //
+// The canons cache their hashes, so this doesn't have to rehash any UTF-8.
+// Lookups on other threads may still be probing the old table (which stays
+// valid, just without the words added from here on), so while tasks are
+// running it is retired instead of freed.
+//
 static void Expand_Word_Table(void)
 {
     // The only full list of canon words available is the old hash table.
@@ -164,7 +221,7 @@ static void Expand_Word_Table(void)
         REBLEN skip;
         REBLEN slot = First_Hash_Candidate_Slot(
             &skip,
-            Hash_String(canon),
+            MISC(canon).hash,
             num_slots
         );
 
@@ -176,27 +233,73 @@ static void Expand_Word_Table(void)
         new_canons_by_hash[slot] = canon;
     }
 
-    Free_Unmanaged_Series(PG_Canons_By_Hash);
-    PG_Canons_By_Hash = ser;
+    REBSER *old = PG_Canons_By_Hash;
+    Store_Release(cast(void**, &PG_Canons_By_Hash), ser);
+
+    if (PG_Tasks_Running)
+        Retired_Word_Tables[Num_Retired_Word_Tables++] = old;
+    else {
+        Free_Retired_Word_Tables();
+        Free_Unmanaged_Series(old);
+    }
 }
 
 
+// Look up a spelling without locking, giving nullptr if it isn't interned
+// (or was interned by another thread since the table being probed was
+// replaced).  This is the same search as Insert_Interning() does.
 //
-//  Intern_UTF8_Managed: C
-//
-// Makes only one copy of each distinct character string:
-//
-// https://en.wikipedia.org/wiki/String_interning
-//
-// Interned UTF8 strings are stored as series, and are implicitly managed
-// by the GC (because they are shared).
-//
-// Interning is case-sensitive, but a "synonym" linkage is established between
-// instances that are just differently upper-or-lower-"cased".  They agree on
-// one "canon" interning to use for fast case-insensitive compares.  If that
-// canon form is GC'd, the agreed upon canon for the group will change.
+static REBSTR *Find_Interning(const REBYTE *utf8, size_t size, REBINT hash)
+{
+    REBSER *table = cast(REBSER*, Load_Acquire(
+        cast(void * const*, &PG_Canons_By_Hash)
+    ));
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+
+    // Insert_Interning() expands the table before it can fill up, but this
+    // runs first, so it may see a full one (e.g. the 1-slot table debug
+    // builds start with).  Hence the probe count, as a NULL may never come.
+    //
+    REBLEN probes = num_slots;
+
+    REBSTR *canon;
+    while (probes-- != 0 and (canon = cast(REBSTR*, Load_Acquire(
+        cast(void * const*, &canons_by_hash[slot])
+    )))){
+        if (canon != DELETED_CANON and MISC(canon).hash == hash) {
+            REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, size);
+            if (cmp == 0)
+                return canon;
+
+            if (cmp > 0) {  // an alternate casing, so look at its synonyms
+                REBSTR *synonym = canon;
+                while ((synonym = cast(REBSTR*, Load_Acquire(
+                    cast(void * const*, &LINK_SYNONYM_NODE(synonym))
+                ))) != canon){
+                    if (Compare_UTF8(STR_HEAD(synonym), utf8, size) == 0)
+                        return synonym;
+                }
+                return nullptr;
+            }
+        }
+
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+
+    return nullptr;
+}
+
+
+// Search for a spelling while holding the lock of Lock_Tasks(), and make a
+// new interning of it if it isn't found.
 //
-REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
+static REBSTR *Insert_Interning(const REBYTE *utf8, size_t size, REBINT hash)
 {
     // The hashing technique used is called "linear probing":
     //
@@ -216,11 +319,7 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
 
     REBLEN skip; // how many slots to skip when occupied candidates found
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_UTF8(utf8, size),
-        num_slots
-    );
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
 
     // The hash table only indexes the canon form of each spelling.  So when
     // testing a slot to see if it's a match (or a collision that needs to
@@ -237,6 +336,13 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 
         assert(GET_SERIES_INFO(canon, STRING_CANON));
 
+        // Spellings which differ only by case hash the same, so a canon with
+        // a different hash can't be a match or a synonym.  Skip it without
+        // walking any UTF-8.
+        //
+        if (MISC(canon).hash != hash)
+            goto next_candidate_slot;
+
         blockscope {
             REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, size);
             if (cmp == 0)
@@ -298,33 +404,34 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     //
     SET_SERIES_INFO(s, FROZEN);
 
+    // Created series must be managed, because if they were not there could
+    // be no clear contract on the return result--as it wouldn't be possible
+    // to know if a shared instance had been managed by someone else or not.
+    // (This is done before Find_Interning() on another thread can see it.)
+    //
+    REBSTR *intern = STR(Manage_Series(s));
+
     if (not canon) {  // no canon found, so this interning must become canon
         SET_SERIES_INFO(s, STRING_CANON);
 
         LINK_SYNONYM_NODE(s) = NOD(s);  // 1-item in circular list
 
-        // Canon symbols use their MISC() to hold binding information.  Long
-        // term, it may become a design that lets multiple binds run at once.
-        // So the slot could hold an atomic pointer that would "pop out" to a
-        // structure.  But for the moment only one bind runs at a time, and
-        // it's randomized to keep its information in high bits or low bits
-        // as a poor-man's demo that there is an infrastructure in place for
-        // sharing (start with 2, grow to N eventually).
+        // Canon symbols use their MISC() to cache the hash of the spelling.
+        // (Binding information is kept by binders, see %sys-bind.h)
         //
-        MISC(s).bind_index.high = 0;
-        MISC(s).bind_index.low = 0;
+        MISC(s).hash = hash;
 
         // leave header.bits as 0 for SYM_0 as answer to VAL_WORD_SYM()
         // Startup_Symbols() tags values from %words.r after the fact.
 
         if (deleted_slot) {
-            *deleted_slot = STR(s);  // reuse the deleted slot
+            Store_Release(cast(void**, deleted_slot), intern);  // reuse it
           #if !defined(NDEBUG)
             --PG_Num_Canon_Deleteds;  // note slot usage count stays constant
           #endif
         }
         else {
-            canons_by_hash[slot] = STR(s);
+            Store_Release(cast(void**, &canons_by_hash[slot]), intern);
             ++PG_Num_Canon_Slots_In_Use;
         }
     }
@@ -333,17 +440,16 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
         // circularly linked list, and direct link the canon form.
         //
         MISC(s).length = 0;  // !!! TBD: codepoint count
-        LINK_SYNONYM_NODE(s) = LINK_SYNONYM_NODE(canon);
-        LINK_SYNONYM_NODE(canon) = NOD(s);
 
         // If the canon form had a SYM_XXX for quick comparison of %words.r
         // words in C switch statements, the synonym inherits that number.
         //
         assert(SECOND_UINT16(s->header) == 0);
         SET_SECOND_UINT16(s->header, STR_SYMBOL(canon));
-    }
 
-    REBSTR *intern = STR(Manage_Series(s));
+        LINK_SYNONYM_NODE(s) = LINK_SYNONYM_NODE(canon);
+        Store_Release(cast(void**, &LINK_SYNONYM_NODE(canon)), NOD(s));
+    }
 
   #if !defined(NDEBUG)
     uint16_t sym_canon = cast(uint16_t, STR_SYMBOL(STR_CANON(intern)));
@@ -351,10 +457,37 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     assert(sym == sym_canon);  // C++ build disallows compare w/o cast
   #endif
 
-    // Created series must be managed, because if they were not there could
-    // be no clear contract on the return result--as it wouldn't be possible
-    // to know if a shared instance had been managed by someone else or not.
-    //
+    return intern;
+}
+
+
+//
+//  Intern_UTF8_Managed: C
+//
+// Makes only one copy of each distinct character string:
+//
+// https://en.wikipedia.org/wiki/String_interning
+//
+// Interned UTF8 strings are stored as series, and are implicitly managed
+// by the GC (because they are shared).
+//
+// Interning is case-sensitive, but a "synonym" linkage is established between
+// instances that are just differently upper-or-lower-"cased".  They agree on
+// one "canon" interning to use for fast case-insensitive compares.  If that
+// canon form is GC'd, the agreed upon canon for the group will change.
+//
+REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
+{
+    REBINT hash = Hash_UTF8(utf8, size);
+
+    REBSTR *intern = Find_Interning(utf8, size, hash);
+    if (intern)
+        return intern;
+
+    Lock_Tasks();
+    intern = Insert_Interning(utf8, size, hash);
+    Unlock_Tasks();
+
     return intern;
 }
 
@@ -368,6 +501,11 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 //
 void GC_Kill_Interning(REBSTR *intern)
 {
+    // The GC doesn't run while Run_Tasks() does, so nothing can be probing
+    // the table or walking synonyms, and they're changed with plain stores.
+    //
+    assert(not PG_Tasks_Running);
+
     REBSTR *synonym = LINK_SYNONYM(intern);
 
     // Note synonym and intern may be the same here.
@@ -380,16 +518,13 @@ void GC_Kill_Interning(REBSTR *intern)
     if (NOT_SERIES_INFO(intern, STRING_CANON))
         return;  // for non-canon forms, removing from chain is all you need
 
-    assert(MISC(intern).bind_index.high == 0);  // shouldn't GC during binds?
-    assert(MISC(intern).bind_index.low == 0);
-
     REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
     REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
 
     REBLEN skip;
     REBLEN slot = First_Hash_Candidate_Slot(
         &skip,
-        Hash_String(intern),
+        MISC(intern).hash,
         num_slots
     );
 
@@ -408,12 +543,11 @@ void GC_Kill_Interning(REBSTR *intern)
         // It should hash the same, and be able to take over the hash slot.
         //
     #ifdef SLOW_INTERN_HASH_DOUBLE_CHECK
-        assert(hash == Hash_String(synonym));
+        assert(MISC(intern).hash == Hash_String(synonym));
     #endif
         canons_by_hash[slot] = synonym;
         SET_SERIES_INFO(synonym, STRING_CANON);
-        MISC(synonym).bind_index.low = 0;
-        MISC(synonym).bind_index.high = 0;
+        MISC(synonym).hash = MISC(intern).hash;
     }
     else {
         // This canon form must be removed from the hash table.  Ripple the
@@ -625,6 +759,7 @@ void Shutdown_Interning(void)
     }
   #endif
 
+    Free_Retired_Word_Tables();
     Free_Unmanaged_Series(PG_Canons_By_Hash);
 }
 
@@ -355,13 +355,11 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
         //
         assert(Is_Marked(spelling));
 
-        assert(  // GC can't run during binding, only time bind indices != 0
-            NOT_SERIES_INFO(spelling, STRING_CANON)
-            or (
-                MISC(spelling).bind_index.high == 0
-                and MISC(spelling).bind_index.low == 0
-            )
-        );
+        // GC can't run during binding.  Binders hold canons in their side
+        // tables without marking them, and if one were GC'd then another
+        // spelling could become the canon for its word.
+        //
+        assert(TG_Num_Binders == 0);
 
         if (IS_WORD_BOUND(v)) {
             assert(PAYLOAD(Any, v).second.i32 > 0);
@@ -72,3 +72,84 @@ REBNATIVE(test_librebol)
     return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
   #endif
 }
+
+
+// What the tasks of TEST-INTERNING share.  Task `n` puts what it got for
+// spelling `i` in results[n * count + i].
+//
+struct Reb_Intern_Test {
+    const REBYTE **utf8;
+    REBSIZ *sizes;
+    REBLEN count;
+    REBLEN num_tasks;
+    REBSTR **results;
+};
+
+static void Intern_Test_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Intern_Test *t = cast(struct Reb_Intern_Test*, opaque);
+
+    // Each task starts at a different place in the list, so that the tasks
+    // are looking up and adding different words at the same time.
+    //
+    REBLEN start = cast(REBLEN, cast(uint64_t, t->count) * n / t->num_tasks);
+    REBLEN k;
+    for (k = 0; k < t->count; ++k) {
+        REBLEN i = (start + k) % t->count;
+        t->results[n * t->count + i] = Intern_UTF8_Managed(
+            t->utf8[i], t->sizes[i]
+        );
+    }
+}
+
+
+//
+//  test-interning: native [
+//
+//  {Intern spellings on all TASK-THREADS threads at once (a stress test)}
+//
+//      return: [integer!]
+//          {How many threads interned every spelling}
+//      spellings [block!]
+//          {TEXT! values, which may have repeats and differently cased forms}
+//  ]
+//
+REBNATIVE(test_interning)
+//
+// Every thread gets the same word for each spelling, or this fails.
+{
+    INCLUDE_PARAMS_OF_TEST_INTERNING;
+
+    REBVAL *spellings = ARG(spellings);
+
+    struct Reb_Intern_Test t;
+    t.count = VAL_LEN_AT(spellings);
+    t.num_tasks = Get_Task_Threads();
+    t.utf8 = rebAllocN(const REBYTE*, t.count);
+    t.sizes = rebAllocN(REBSIZ, t.count);
+    t.results = rebAllocN(REBSTR*, t.num_tasks * t.count);
+
+    RELVAL *item = VAL_ARRAY_AT(spellings);
+    REBLEN i;
+    for (i = 0; i < t.count; ++i, ++item) {
+        if (not IS_TEXT(item))
+            fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(spellings)));
+        t.utf8[i] = VAL_UTF8_AT(&t.sizes[i], item);
+    }
+
+    Run_Tasks(&Intern_Test_Task, &t, t.num_tasks);
+
+    REBLEN n;
+    for (n = 1; n < t.num_tasks; ++n) {
+        for (i = 0; i < t.count; ++i) {
+            if (t.results[n * t.count + i] != t.results[i])
+                fail ("Threads interned a spelling as different words");
+        }
+    }
+
+    rebFree(t.results);
+    rebFree(t.sizes);
+    rebFree(t.utf8);
+
+    return Init_Integer(D_OUT, t.num_tasks);
+}
@@ -24,6 +24,7 @@
 
 #include "sys-core.h"
 
+#define MIN_SHARED_ARRAY_LEN 16  // smaller copies are cheaper than holders
 
 //
 //  Copy_Array_At_Extra_Shallow: C
@@ -302,6 +303,165 @@ REBARR *Copy_Array_Core_Managed(
 }
 
 
+//
+//  Is_Array_Shareable: C
+//
+// Copy_Array_Shared_Managed() can only lend out the data of a plain managed
+// array, and only from some position through the tail.  Every cell also has
+// to be usable by the copy as-is: so none can be relative to a function or
+// be a series that the copy is supposed to duplicate, and there can be no
+// const bits to add (Clonify() would have marked the shallow references).
+//
+static bool Is_Array_Shareable(
+    REBARR *a,
+    REBLEN index,
+    REBLEN tail,
+    REBFLGS flags,
+    REBU64 types
+){
+    if (tail != ARR_LEN(a) or tail - index < MIN_SHARED_ARRAY_LEN)
+        return false;
+
+    if (flags & ARRAY_FLAG_CONST_SHALLOW)
+        return false;
+
+    if (
+        not IS_SER_DYNAMIC(a)
+        or NOT_SERIES_FLAG(a, MANAGED)
+        or GET_SERIES_FLAG(a, FIXED_SIZE)
+        or GET_ARRAY_FLAG(a, IS_VARLIST)
+        or GET_ARRAY_FLAG(a, IS_PARAMLIST)
+        or GET_ARRAY_FLAG(a, IS_PAIRLIST)
+        or GET_SERIES_FLAG(a, MISC_NODE_NEEDS_MARK)
+    ){
+        return false;
+    }
+
+    if (
+        GET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK)
+        and NOT_ARRAY_FLAG(a, HAS_FILE_LINE_UNMASKED)
+        and NOT_SERIES_INFO(a, SHARED)
+    ){
+        return false;  // LINK() is used for something other than a file
+    }
+
+    const RELVAL *v = ARR_AT(a, index);
+    for (; NOT_END(v); ++v) {
+        if (IS_RELATIVE(v))
+            return false;
+
+        if (types & FLAGIT_KIND(CELL_KIND(VAL_UNESCAPED(v))) & TS_SERIES_OBJ)
+            return false;
+    }
+
+    return true;
+}
+
+
+//
+//  Clonify_Shared: C
+//
+// Clonify() for the cells of a COPY/SHARE, which makes nested arrays and
+// binaries into shared copies instead of duplicating them.
+//
+static void Clonify_Shared(
+    REBVAL *v,
+    REBFLGS flags,
+    REBU64 types
+){
+    if (C_STACK_OVERFLOWING(&types))
+        Fail_Stack_Overflow();
+
+    enum Reb_Kind kind = CELL_KIND(VAL_UNESCAPED(v));
+    if (
+        not (types & FLAGIT_KIND(kind))
+        or not (ANY_ARRAY_KIND(kind) or kind == REB_BINARY)
+    ){
+        Clonify(v, flags, types);
+        return;
+    }
+
+    REBLEN num_quotes = VAL_NUM_QUOTES(v);
+    Dequotify(v);
+
+    if (kind == REB_BINARY) {
+        REBSER *s = VAL_SERIES(v);
+        INIT_VAL_NODE(v, Copy_Sequence_Shared_Managed(s, 0, SER_USED(s)));
+    }
+    else {
+        REBARR *a = VAL_ARRAY(v);
+        INIT_VAL_NODE(
+            v,
+            Copy_Array_Shared_Managed(
+                a,
+                0, // !!! same question as in Clonify() for nonzero VAL_INDEX
+                VAL_SPECIFIER(v),
+                ARR_LEN(a),
+                flags,
+                types
+            )
+        );
+        INIT_BINDING(v, UNBOUND);  // copy isn't relative any more
+    }
+
+    Quotify(v, num_quotes);
+}
+
+
+//
+//  Copy_Array_Shared_Managed: C
+//
+// Variant of Copy_Array_Core_Managed() for COPY/SHARE, which puts off the
+// work of copying a large array until the copy or the original is changed.
+// The result borrows the original's cells (see Share_Series_Data()), and
+// the first FAIL_IF_READ_ONLY() on either one gives it a private copy.
+//
+// When `types` asks for nested series to be copied, the array holding them
+// has to be physically copied, so its cells can point at the new series.
+// But each of those is a shared copy in turn, so a COPY/DEEP only pays for
+// the levels leading to series that are actually written to.
+//
+REBARR *Copy_Array_Shared_Managed(
+    REBARR *original,
+    REBLEN index,
+    REBSPC *specifier,
+    REBLEN tail,
+    REBFLGS flags,
+    REBU64 types
+){
+    if (index > tail)
+        index = tail;
+
+    flags |= NODE_FLAG_MANAGED;
+
+    if (index > ARR_LEN(original))
+        return Make_Array_Core(0, flags);
+
+    if (Is_Array_Shareable(original, index, tail, flags, types)) {
+        REBARR *copy = Make_Array_For_Copy(  // LINK() will be the holder
+            0,
+            flags & ~ARRAY_MASK_HAS_FILE_LINE,
+            original
+        );
+        Share_Series_Data(SER(copy), SER(original), index);
+        return copy;
+    }
+
+    REBLEN len = tail - index;
+    REBARR *copy = Make_Array_For_Copy(len, flags, original);
+
+    RELVAL *src = ARR_AT(original, index);
+    RELVAL *dest = ARR_HEAD(copy);
+    REBLEN count = 0;
+    for (; count < len; ++count, ++dest, ++src)
+        Clonify_Shared(Derelativize(dest, src, specifier), flags, types);
+
+    TERM_ARRAY_LEN(copy, len);
+
+    return copy;
+}
+
+
 //
 //  Copy_Rerelativized_Array_Deep_Managed: C
 //
@@ -167,12 +167,46 @@ static const REBYTE Enbase64[64] =
 
 
 //
-//  Decode_Base2: C
+// Hex digit values for the base-16 decoder's fast path, with BIN_ERROR for
+// any character that isn't a hex digit (so the values of a pair of digits
+// can be OR'd together and checked for validity at once).
 //
-static REBSER *Decode_Base2(const REBYTE **src, REBLEN len, REBYTE delim)
+static const REBYTE Debase16[128] =
 {
+    #define XX BIN_ERROR
+
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 00
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 10
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 20
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, XX, XX, XX, XX, XX, XX, // 30
+    XX, 10, 11, 12, 13, 14, 15, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 40
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 50
+    XX, 10, 11, 12, 13, 14, 15, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 60
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, // 70
+
+    #undef XX
+};
+
+
+//
+//  Decode_Base2: C
+//
+// All of the decoders take the position to start at in `src`, and update it
+// to where they stopped.  On an error this is the offending byte (and the
+// result is NULL).  On success it is the end of the input or the delimiter,
+// unless `partial` was requested--in which case it is the start of any group
+// of digits that didn't complete a byte.  That lets input which arrives in
+// chunks be decoded a chunk at a time, carrying over the unused bytes.
+//
+static REBSER *Decode_Base2(
+    const REBYTE **src,
+    REBLEN len,
+    REBYTE delim,
+    bool partial
+){
     REBYTE *bp;
     const REBYTE *cp;
+    const REBYTE *group = *src;  // where the byte being accumulated started
     REBLEN count = 0;
     REBLEN accum = 0;
     REBYTE lex;
@@ -194,6 +228,9 @@ static REBSER *Decode_Base2(const REBYTE **src, REBLEN len, REBYTE delim)
             else if (*cp == '1') accum = (accum * 2) + 1;
             else goto err;
 
+            if (count == 0)
+                group = cp;
+
             if (count++ >= 7) {
                 *bp++ = cast(REBYTE, accum);
                 count = 0;
@@ -202,11 +239,16 @@ static REBSER *Decode_Base2(const REBYTE **src, REBLEN len, REBYTE delim)
         }
         else if (!*cp || lex > LEX_DELIMIT_RETURN) goto err;
     }
-    if (count) goto err; // improper modulus
+    if (count) {
+        if (not partial)
+            goto err; // improper modulus
+        cp = group;
+    }
 
     *bp = 0;
     SET_SERIES_LEN(ser, bp - BIN_HEAD(ser));
     ASSERT_SERIES_TERM(ser);
+    *src = cp;
     return ser;
 
 err:
@@ -219,10 +261,15 @@ err:
 //
 //  Decode_Base16: C
 //
-static REBSER *Decode_Base16(const REBYTE **src, REBLEN len, REBYTE delim)
-{
+static REBSER *Decode_Base16(
+    const REBYTE **src,
+    REBLEN len,
+    REBYTE delim,
+    bool partial
+){
     REBYTE *bp;
     const REBYTE *cp;
+    const REBYTE *group = *src;  // where the current digit pair started
     REBLEN count = 0;
     REBLEN accum = 0;
     REBYTE lex;
@@ -233,8 +280,36 @@ static REBSER *Decode_Base16(const REBYTE **src, REBLEN len, REBYTE delim)
     bp = BIN_HEAD(ser);
     cp = *src;
 
+    // The fast path can't look for the delimiter if it's a hex digit.
+    //
+    bool fast = (
+        delim == 0
+        or delim > 127
+        or (Debase16[delim] & BIN_ERROR)
+    );
+
     for (; len > 0; cp++, len--) {
 
+        // Runs of digit pairs with no whitespace (e.g. all of what ENBASE
+        // makes without line breaks) decode two bytes of input at a time.
+        // Anything else drops through to the per-character handling below.
+        //
+        if (fast and not (count & 1)) {
+            while (len >= 2) {
+                if ((cp[0] | cp[1]) & 0x80)
+                    break;
+                REBYTE hi = Debase16[cp[0]];
+                REBYTE lo = Debase16[cp[1]];
+                if ((hi | lo) & BIN_ERROR)
+                    break;
+                *bp++ = cast(REBYTE, (hi << 4) | lo);
+                cp += 2;
+                len -= 2;
+            }
+            if (len == 0)
+                break;
+        }
+
         if (delim && *cp == delim) break;
 
         lex = Lex_Map[*cp];
@@ -242,16 +317,23 @@ static REBSER *Decode_Base16(const REBYTE **src, REBLEN len, REBYTE delim)
         if (lex > LEX_WORD) {
             val = lex & LEX_VALUE; // char num encoded into lex
             if (!val && lex < LEX_NUMBER) goto err;  // invalid char (word but no val)
+            if (not (count & 1))
+                group = cp;
             accum = (accum << 4) + val;
             if (count++ & 1) *bp++ = cast(REBYTE, accum);
         }
         else if (!*cp || lex > LEX_DELIMIT_RETURN) goto err;
     }
-    if (count & 1) goto err; // improper modulus
+    if (count & 1) {
+        if (not partial)
+            goto err; // improper modulus
+        cp = group;
+    }
 
     *bp = 0;
     SET_SERIES_LEN(ser, bp - BIN_HEAD(ser));
     ASSERT_SERIES_TERM(ser);
+    *src = cp;
     return ser;
 
 err:
@@ -264,10 +346,15 @@ err:
 //
 //  Decode_Base64: C
 //
-static REBSER *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
-{
+static REBSER *Decode_Base64(
+    const REBYTE **src,
+    REBLEN len,
+    REBYTE delim,
+    bool partial
+){
     REBYTE *bp;
     const REBYTE *cp;
+    const REBYTE *group = *src;  // where the current 4 character group began
     REBLEN flip = 0;
     REBLEN accum = 0;
     REBYTE lex;
@@ -279,8 +366,49 @@ static REBSER *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
     bp = BIN_HEAD(ser);
     cp = *src;
 
+    // The fast path can't look for the delimiter if it's a base-64 digit.
+    //
+    bool fast = (
+        delim == 0
+        or delim > 127
+        or (Debase64[delim] & (BIN_ERROR | BIN_SPACE))
+    );
+
     for (; len > 0; cp++, len--) {
 
+        // Whole groups of 4 digits are decoded at once, as long as there's no
+        // whitespace, padding, or non-ASCII byte.  OR'ing the table entries
+        // together checks all four for errors and spaces with one test.
+        //
+        if (fast and flip == 0) {
+            while (len >= 4) {
+                if ((cp[0] | cp[1] | cp[2] | cp[3]) & 0x80)
+                    break;
+                REBYTE a = Debase64[cp[0]];
+                REBYTE b = Debase64[cp[1]];
+                REBYTE c = Debase64[cp[2]];
+                REBYTE d = Debase64[cp[3]];
+                if ((a | b | c | d) & (BIN_ERROR | BIN_SPACE))
+                    break;
+                if (
+                    cp[0] == '=' or cp[1] == '='  // "=" is in the table as 0
+                    or cp[2] == '=' or cp[3] == '='
+                ){
+                    break;
+                }
+
+                uint32_t bits = (a << 18) | (b << 12) | (c << 6) | d;
+                bp[0] = cast(REBYTE, bits >> 16);
+                bp[1] = cast(REBYTE, bits >> 8);
+                bp[2] = cast(REBYTE, bits);
+                bp += 3;
+                cp += 4;
+                len -= 4;
+            }
+            if (len == 0)
+                break;
+        }
+
         // Check for terminating delimiter (optional):
         if (delim && *cp == delim) break;
 
@@ -295,6 +423,8 @@ static REBSER *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
         if (lex < BIN_SPACE) {
 
             if (*cp != '=') {
+                if (flip == 0)
+                    group = cp;
                 accum = (accum << 6) + lex;
                 if (flip++ == 3) {
                     *bp++ = cast(REBYTE, accum >> 16);
@@ -313,8 +443,14 @@ static REBSER *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
                     flip = 0;
                 }
                 else if (flip == 2) {
-                    if (!Skip_To_Byte(cp, cp + len, '=')) goto err;
-                    cp++;
+                    const REBYTE *pad = Skip_To_Byte(cp, cp + len, '=');
+                    if (not pad) {
+                        if (not partial)
+                            goto err;
+                        cp = group;  // second "=" may be in the next chunk
+                        goto finished;
+                    }
+                    cp = pad + 1;
                     *bp++ = cast(REBYTE, accum >> 4);
                     flip = 0;
                 }
@@ -325,11 +461,17 @@ static REBSER *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
         else if (lex == BIN_ERROR) goto err;
     }
 
-    if (flip) goto err;
+    if (flip) {
+        if (not partial)
+            goto err;
+        cp = group;
+    }
 
+  finished:
     *bp = 0;
     SET_SERIES_LEN(ser, bp - BIN_HEAD(ser));
     ASSERT_SERIES_TERM(ser);
+    *src = cp;
     return ser;
 
 err:
@@ -342,26 +484,28 @@ err:
 //
 //  Decode_Binary: C
 //
-// Scan and convert a binary string.
+// Scan and convert a binary string.  Returns where the decoding stopped, or
+// NULL if the input was invalid.  See Decode_Base2() for how `partial` works.
 //
 const REBYTE *Decode_Binary(
     RELVAL *out,
     const REBYTE *src,
     REBLEN len,
     REBINT base,
-    REBYTE delim
+    REBYTE delim,
+    bool partial
 ) {
     REBSER *ser = 0;
 
     switch (base) {
     case 64:
-        ser = Decode_Base64(&src, len, delim);
+        ser = Decode_Base64(&src, len, delim, partial);
         break;
     case 16:
-        ser = Decode_Base16(&src, len, delim);
+        ser = Decode_Base16(&src, len, delim, partial);
         break;
     case 2:
-        ser = Decode_Base2 (&src, len, delim);
+        ser = Decode_Base2(&src, len, delim, partial);
         break;
     }
 
@@ -408,6 +552,35 @@ void Form_Base2(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
 }
 
 
+#ifdef CPU_X86_SSE2
+    //
+    // 16 bytes to 32 uppercase hex digits.  Each nibble n becomes '0' + n,
+    // plus 'A' - '0' - 10 more where n > 9.
+    //
+    inline static void Form_Hex16_Sse2(REBYTE *bp, const REBYTE *src) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+        __m128i nibble = _mm_set1_epi8(0x0F);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+        __m128i lo = _mm_and_si128(in, nibble);
+
+        __m128i nine = _mm_set1_epi8(9);
+        __m128i zero = _mm_set1_epi8('0');
+        __m128i letter = _mm_set1_epi8('A' - '0' - 10);
+        hi = _mm_add_epi8(
+            _mm_add_epi8(hi, zero),
+            _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letter)
+        );
+        lo = _mm_add_epi8(
+            _mm_add_epi8(lo, zero),
+            _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letter)
+        );
+
+        _mm_storeu_si128(cast(__m128i*, bp), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(cast(__m128i*, bp + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+
+
 //
 //  Form_Base16: C
 //
@@ -418,26 +591,96 @@ void Form_Base16(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
     if (len == 0)
         return;
 
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor"):
+    // The exact size is known, so the digits are written straight into the
+    // mold buffer instead of appending (and checking capacity) per digit.
     //
-    //     len * 2 + len / 32 + 32
+    REBLEN num_bytes = len * 2;
+    if (brk)
+        num_bytes += len / 32 + 2;  // LF per line, plus leading and trailing
+
+    REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
+    REBYTE *start = Prep_Mold_Overestimated(mo, num_bytes);
+    REBYTE *bp = start;
 
     if (brk and len >= 32)
-        Append_Codepoint(mo->series, LF);
+        *bp++ = LF;
+
+    REBLEN left = len;
+    while (left > 0) {
+        REBLEN run = (brk and left > 32) ? 32 : left;  // bytes in this line
+        left -= run;
+
+      #ifdef CPU_X86_SSE2
+        for (; run >= 16; run -= 16, src += 16, bp += 32)
+            Form_Hex16_Sse2(bp, src);
+      #endif
+
+        for (; run > 0; --run, ++src) {
+            bp[0] = Hex_Digits[*src >> 4];
+            bp[1] = Hex_Digits[*src & 0xF];
+            bp += 2;
+        }
 
-    REBLEN count;
-    for (count = 1; count <= len; count++) {
-        Form_Hex2(mo, *src++);
-        if (brk and ((count % 32) == 0))
-            Append_Codepoint(mo->series, LF);
+        if (brk and (len - left) % 32 == 0)
+            *bp++ = LF;
     }
 
-    if (brk and (len >= 32) and *BIN_LAST(SER(mo->series)) != LF)
-        Append_Codepoint(mo->series, LF);
+    if (brk and (len >= 32) and bp[-1] != LF)
+        *bp++ = LF;
+
+    REBSIZ added = bp - start;
+    TERM_STR_LEN_SIZE(s, old_len + added, old_size + added);
 }
 
 
+#ifdef CPU_X86_DISPATCH
+    //
+    // 12 bytes to 16 base-64 characters, by Wojciech Mula's method: PSHUFB
+    // spreads each group's 3 bytes over a 32-bit lane, multiplies shift the
+    // four 6-bit indices into their own bytes, and a second PSHUFB picks the
+    // offset from the index to its character.  Reads 16 bytes of `src`.
+    //
+    // http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+    //
+    CPU_TARGET("ssse3")
+    static void Form_Base64_12_Ssse3(REBYTE *bp, const REBYTE *src) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+        ));
+
+        __m128i ac = _mm_mulhi_epu16(  // 1st and 3rd index of each group
+            _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+            _mm_set1_epi32(0x04000040)
+        );
+        __m128i bd = _mm_mullo_epi16(  // 2nd and 4th
+            _mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+            _mm_set1_epi32(0x01000010)
+        );
+        __m128i index = _mm_or_si128(ac, bd);
+
+        // 0..25 => 13, 26..51 => 0, 52..61 => 1..10, 62 => 11, 63 => 12
+        //
+        __m128i which = _mm_subs_epu8(index, _mm_set1_epi8(51));
+        which = _mm_or_si128(which, _mm_and_si128(
+            _mm_cmpgt_epi8(_mm_set1_epi8(26), index),
+            _mm_set1_epi8(13)
+        ));
+        __m128i offsets = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0
+        );
+        _mm_storeu_si128(
+            cast(__m128i*, bp),
+            _mm_add_epi8(_mm_shuffle_epi8(offsets, which), index)
+        );
+    }
+#endif
+
+
 //
 //  Form_Base64: C
 //
@@ -446,53 +689,81 @@ void Form_Base16(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
 // !!! Strongly parallels this code, may have originated from it:
 // http://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
 //
+// Output for a `len` that is a multiple of 3 has no padding, so the encoding
+// of data that arrives in chunks can be built up a chunk at a time when the
+// chunks are sized that way (e.g. 48K), without line breaks.
+//
 void Form_Base64(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
 {
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor") and preallocate size for that.  Now
-    // it appends one character at a time and relies upon the mold buffer's
-    // natural expansion.  Review if it needs the optimization.
+    REBLEN whole = len / 3;  // 3-byte groups, each encoded as 4 characters
 
-    REBSTR *s = mo->series;
+  #ifdef CPU_X86_DISPATCH
+    const REBYTE *src_tail = src + len;  // SIMD reads 16 bytes for 12
+  #endif
 
-    REBINT loop = cast(int, len / 3) - 1;
-    if (brk and 4 * loop > 64)
-        Append_Codepoint(s, LF);
+    // The exact size is known, so the characters are written straight into
+    // the mold buffer instead of appending (and checking capacity) per
+    // character.  Lines are 16 groups (48 bytes in, 64 characters out).
+    //
+    REBLEN num_bytes = 4 * ((len + 2) / 3);
+    if (brk)
+        num_bytes += whole / 16 + 2;  // LF per line, plus leading and trailing
 
-    REBINT x;
-    for (x = 0; x <= 3 * loop; x += 3) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x] & 0x3) << 4) + (src[x + 1] >> 4)]
-        );
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x + 1] & 0xF) << 2) + (src[x + 2] >> 6)]
-        );
-        Append_Codepoint(s, Enbase64[(src[x + 2] % 0x40)]);
-        if ((x + 3) % 48 == 0 && brk)
-            Append_Codepoint(s, LF);
+    REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
+    REBYTE *start = Prep_Mold_Overestimated(mo, num_bytes);
+    REBYTE *bp = start;
+
+    if (brk and whole > 17)  // historical threshold, a bit over one line
+        *bp++ = LF;
+
+    REBLEN left = whole;
+    while (left > 0) {
+        REBLEN run = (brk and left > 16) ? 16 : left;  // groups in this line
+        left -= run;
+
+      #ifdef CPU_X86_DISPATCH
+        if (Cpu_Has(CPU_SSSE3)) {
+            for (; run >= 4 and src_tail - src >= 16; run -= 4) {
+                Form_Base64_12_Ssse3(bp, src);
+                src += 12;
+                bp += 16;
+            }
+        }
+      #endif
+
+        for (; run > 0; --run, src += 3) {
+            uint32_t bits = (src[0] << 16) | (src[1] << 8) | src[2];
+            bp[0] = Enbase64[bits >> 18];
+            bp[1] = Enbase64[(bits >> 12) & 0x3F];
+            bp[2] = Enbase64[(bits >> 6) & 0x3F];
+            bp[3] = Enbase64[bits & 0x3F];
+            bp += 4;
+        }
+
+        if (brk and (whole - left) % 16 == 0)
+            *bp++ = LF;
     }
 
-    if ((len % 3) != 0) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
+    if (len % 3 != 0) {
+        *bp++ = Enbase64[src[0] >> 2];
 
-        if (len - x == 1) {
-            Append_Codepoint(s, Enbase64[((src[x] & 0x3) << 4)]);
-            Append_Codepoint(s, '=');
+        if (len % 3 == 1) {
+            *bp++ = Enbase64[(src[0] & 0x3) << 4];
+            *bp++ = '=';
         }
         else {
-            Append_Codepoint(
-                s,
-                Enbase64[((src[x] & 0x3) << 4) | (src[x + 1] >> 4)]
-            );
-            Append_Codepoint(s, Enbase64[(src[x + 1] & 0xF) << 2]);
+            *bp++ = Enbase64[((src[0] & 0x3) << 4) | (src[1] >> 4)];
+            *bp++ = Enbase64[(src[1] & 0xF) << 2];
         }
 
-        Append_Codepoint(s, '=');
+        *bp++ = '=';
     }
 
-    if (brk and x > 49 and *BIN_LAST(SER(s)) != LF)
-        Append_Codepoint(s, LF);
+    if (brk and 3 * whole > 49 and bp[-1] != LF)
+        *bp++ = LF;
+
+    REBSIZ added = bp - start;
+    TERM_STR_LEN_SIZE(s, old_len + added, old_size + added);
 }
@@ -254,14 +254,22 @@ REBINT Emit_Decimal(
     REBYTE *start = cp, *sig, *rve;
     int e, sgn;
     REBINT digits_obtained;
+    REBYTE shortest[MAX_DIGITS + 1];
 
     /* sanity checks */
     if (decimal_digits < MIN_DIGITS) decimal_digits = MIN_DIGITS;
     else if (decimal_digits > MAX_DIGITS) decimal_digits = MAX_DIGITS;
 
-    sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
-
-    digits_obtained = rve - sig;
+    // Mode 0 of dtoa() is the shortest round-trip digits, which is what
+    // Fast_Dtoa() makes in the common case (see %f-float.c)
+    //
+    digits_obtained = Fast_Dtoa(shortest, &e, &sgn, d);
+    if (digits_obtained != 0)
+        sig = shortest;
+    else {
+        sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
+        digits_obtained = rve - sig;
+    }
 
     /* handle sign */
     if (sgn) *cp++ = '-';
@@ -2448,6 +2448,342 @@ void Scan_To_Stack_Relaxed(SCAN_STATE *ss) {
 }
 
 
+// Byte-level check of whether the top-level value starting at `bp` might
+// only be ended by more input: that is, no whitespace is reached outside of
+// any BLOCK!, GROUP! or string before the input runs out.  A token cut off
+// mid-way by a chunk boundary (e.g. a `#"` or half of a UTF-8 character)
+// will fail to scan, but that error is not a genuine one if this is true.
+//
+static bool Value_May_Run_To_End(const REBYTE *bp)
+{
+    while (IS_LEX_SPACE(*bp) or ANY_CR_LF_END(*bp)) {
+        if (*bp == '\0')
+            return true;
+        ++bp;
+    }
+
+    REBINT depth = 0;  // nesting of [ and (
+    for (; *bp != '\0'; ++bp) {
+        switch (*bp) {
+          case '[':
+          case '(':
+            ++depth;
+            break;
+
+          case ']':
+          case ')':
+            if (--depth < 0)
+                return false;  // not balanced, so not a cut-off value
+            break;
+
+          case ';':  // comment runs to the end of line
+            while (bp[1] != '\0' and bp[1] != LF)
+                ++bp;
+            break;
+
+          case '"':  // string can't span lines, `^` escapes the next byte
+            for (++bp; *bp != '"'; ++bp) {
+                if (*bp == '\0')
+                    return true;
+                if (*bp == LF)
+                    return false;
+                if (*bp == '^' and bp[1] != '\0')
+                    ++bp;
+            }
+            break;
+
+          case '{': {  // string (or BINARY!) with nested braces
+            REBINT braces = 1;
+            for (++bp; braces != 0; ++bp) {
+                if (*bp == '\0')
+                    return true;
+                if (*bp == '^' and bp[1] != '\0')
+                    ++bp;
+                else if (*bp == '{')
+                    ++braces;
+                else if (*bp == '}')
+                    --braces;
+            }
+            --bp;
+            break; }
+
+          default:
+            if (depth == 0 and (IS_LEX_SPACE(*bp) or ANY_CR_LF_END(*bp)))
+                return false;
+            break;
+        }
+    }
+    return true;
+}
+
+
+//
+//  Scan_To_Stack_Partial: C
+//
+// Used when the source is only a prefix of the full input, such as one chunk
+// of a large file that is being read and scanned a piece at a time.  Only
+// top-level values known to be complete are pushed, and the scan state is
+// left at the start of whatever isn't (so the caller can keep those bytes,
+// append the next chunk to them, and continue scanning from there).
+//
+// A top-level value is considered complete if there is at least one byte of
+// input after it which the scan of the value did not consume.  That byte
+// must be a delimiter (e.g. `abc` and `a/b` could be continued by the next
+// chunk, while `abc ` can't).  Trailing whitespace and comments are left
+// unconsumed, since a comment without its newline could also continue.
+//
+// A scan error only means the last value is incomplete if it is for a
+// missing closing delimiter, or if the value it happened in may run up to
+// the end of the input (see Value_May_Run_To_End()).  Other errors are
+// genuine, and are raised right away.
+//
+void Scan_To_Stack_Partial(SCAN_STATE *ss, bool just_once)
+{
+    while (true) {
+        SCAN_STATE ss_before = *ss;
+        REBDSP dsp_before = DSP;
+
+        ss->opts |= SCAN_FLAG_NEXT;  // Scan_To_Stack() clears it each time
+
+        REBVAL *error = rebRescue(cast(REBDNG*, &Scan_To_Stack), ss);
+        if (error) {  // rebRescue() has restored the data stack
+            REBCTX *ctx = VAL_CONTEXT(error);
+            rebRelease(error);
+
+            ERROR_VARS *vars = ERR_VARS(ctx);
+            if (
+                VAL_WORD_SYM(&vars->id) != SYM_SCAN_MISSING
+                and not Value_May_Run_To_End(ss_before.begin)
+            ){
+                fail (ctx);
+            }
+
+            *ss = ss_before;
+            return;
+        }
+
+        if (DSP == dsp_before or *ss->begin == '\0') {
+            DS_DROP_TO(dsp_before);  // nothing, or value may be incomplete
+            *ss = ss_before;
+            return;
+        }
+
+        if (just_once)
+            return;
+    }
+}
+
+
+//
+//  Find_Scan_Splits: C
+//
+// Prescan UTF-8 source for line breaks at which it could be cut into pieces
+// that scan independently, giving the same values as scanning it whole.
+// That is a line break outside of any BLOCK!, GROUP!, string or comment.
+// Up to `max` splits are written to `offsets` (byte positions of the line
+// break, so each piece after the first starts with one and its first value
+// keeps its newline marker) and `lines` (count of line breaks before it).
+// Pieces will be at least `min_piece` bytes long, except for the last one.
+//
+// This is only a byte-level approximation of the scanner (e.g. it doesn't
+// know about tags, which may contain brackets).  So a split it finds is not
+// guaranteed to be valid...but a bad split yields a piece with unbalanced
+// delimiters, and a scan error in any piece falls back on a whole scan.
+//
+REBLEN Find_Scan_Splits(
+    REBSIZ *offsets,
+    REBLEN *lines,
+    REBLEN max,
+    const REBYTE *bp,
+    REBSIZ size,
+    REBSIZ min_piece
+){
+    REBLEN num_splits = 0;
+    REBLEN line_breaks = 0;
+    REBINT depth = 0;  // nesting of [ and (
+    REBSIZ last = 0;
+
+    REBSIZ i;
+    for (i = 0; i < size and num_splits < max; ++i) {
+        switch (bp[i]) {
+          case LF:
+            if (depth == 0 and i - last >= min_piece) {
+                REBSIZ offset = (i > 0 and bp[i - 1] == CR) ? i - 1 : i;
+                offsets[num_splits] = offset;
+                lines[num_splits] = line_breaks;
+                ++num_splits;
+                last = offset;
+            }
+            ++line_breaks;
+            break;
+
+          case '[':
+          case '(':
+            ++depth;
+            break;
+
+          case ']':
+          case ')':
+            if (--depth < 0)
+                return num_splits;  // let the scan of the last piece fail
+            break;
+
+          case ';':  // comment runs to the end of line (but leave the LF)
+            while (i + 1 < size and bp[i + 1] != LF)
+                ++i;
+            break;
+
+          case '"':  // string can't span lines, `^` escapes the next byte
+            for (++i; i < size and bp[i] != '"'; ++i) {
+                if (bp[i] == LF)
+                    return num_splits;  // unterminated
+                if (bp[i] == '^')
+                    ++i;
+            }
+            break;
+
+          case '{': {  // nested-brace string (or BINARY!), may span lines
+            REBINT braces = 1;
+            for (++i; i < size; ++i) {
+                if (bp[i] == '^')
+                    ++i;
+                else if (bp[i] == '{')
+                    ++braces;
+                else if (bp[i] == '}') {
+                    if (--braces == 0)
+                        break;
+                }
+                else if (bp[i] == LF)
+                    ++line_breaks;
+            }
+            break; }
+
+          default:
+            break;
+        }
+    }
+
+    return num_splits;
+}
+
+
+// What Scan_Pieces_Core() needs, passed through rebRescue().
+//
+struct Reb_Scan_Pieces {
+    SCAN_STATE *ss;
+    REBSIZ size;
+    REBSIZ *offsets;
+    REBLEN *lines;
+    REBLEN num_splits;
+    REBSER *bin;  // one copy of the source, to '\0'-terminate each piece in
+};
+
+static REBVAL *Scan_Pieces_Core(struct Reb_Scan_Pieces *p)
+{
+    REBYTE *head = BIN_HEAD(p->bin);
+    SCAN_STATE piece;
+
+    REBSIZ start = 0;
+    REBLEN n;
+    for (n = 0; n <= p->num_splits; ++n) {
+        REBSIZ end = (n == p->num_splits) ? p->size : p->offsets[n];
+        REBYTE saved = head[end];
+        head[end] = '\0';  // the scanner stops at '\0' (it has no limit)
+
+        Init_Scan_State(
+            &piece,
+            p->ss->file,
+            p->ss->line + (n == 0 ? 0 : p->lines[n - 1]),
+            head + start,
+            end - start
+        );
+        piece.opts = p->ss->opts;
+        Scan_To_Stack(&piece);
+
+        head[end] = saved;
+        start = end;
+    }
+
+    p->ss->begin += p->size;
+    p->ss->line = piece.line;
+    p->ss->newline_pending = piece.newline_pending;
+    return nullptr;
+}
+
+
+//
+//  Scan_To_Stack_Pieces: C
+//
+// Scan the source in independently scanned pieces, split where the cheap
+// Find_Scan_Splits() prescan says it is safe to.  The results are the same
+// as Scan_To_Stack() (including line numbers and newline markers).
+//
+// The source is copied once, so that each piece can be terminated in place
+// where the next one starts, and a failure in any piece falls back on one
+// whole scan.  Pieces are the unit that scanning on several cores would work
+// in, which the prescan is there to find.
+//
+// !!! The pieces are scanned one after another, as the scanner makes series
+// from the GC's pools and pushes to the data stack.  (Interning words is the
+// one part that tasks may already do, see Intern_UTF8_Managed().)  A piece
+// could only be scanned on another thread once it can build values in memory
+// of its own, to be adopted after a join.
+//
+void Scan_To_Stack_Pieces(SCAN_STATE *ss, REBSIZ size, REBLEN max_pieces)
+{
+    REBSIZ offsets[MAX_SCAN_PIECES];
+    REBLEN lines[MAX_SCAN_PIECES];
+
+    if (max_pieces > MAX_SCAN_PIECES)
+        max_pieces = MAX_SCAN_PIECES;
+
+    REBLEN num_splits = 0;
+    if (max_pieces > 1)
+        num_splits = Find_Scan_Splits(
+            offsets,
+            lines,
+            max_pieces - 1,
+            ss->begin,
+            size,
+            size / max_pieces
+        );
+
+    if (num_splits == 0) {
+        Scan_To_Stack(ss);
+        return;
+    }
+
+    REBSER *bin = Make_Binary(size);
+    SET_SERIES_FLAG(bin, DONT_RELOCATE);  // BIN_HEAD() is cached
+    memcpy(BIN_HEAD(bin), ss->begin, size);
+    TERM_BIN_LEN(bin, size);
+
+    struct Reb_Scan_Pieces pieces;
+    pieces.ss = ss;
+    pieces.size = size;
+    pieces.offsets = offsets;
+    pieces.lines = lines;
+    pieces.num_splits = num_splits;
+    pieces.bin = bin;
+
+    REBDSP dsp_orig = DSP;
+    REBVAL *error = rebRescue(cast(REBDNG*, &Scan_Pieces_Core), &pieces);
+
+    Free_Unmanaged_Series(bin);
+
+    if (error) {
+        //
+        // Either the source has a genuine syntax error, or the prescan chose
+        // a bad split.  A whole scan will tell which (and will report any
+        // error the same way it would have without pieces).
+        //
+        rebRelease(error);
+        DS_DROP_TO(dsp_orig);
+        Scan_To_Stack(ss);
+    }
+}
+
+
 //
 //  Scan_Child_Array: C
 //
@@ -2626,6 +2962,9 @@ void Shutdown_Scanner(void)
 //      /next "Translate next complete value (blocks as single value)"
 //      /only "Translate only a single value (blocks dissected)"
 //      /relax "Do not cause errors - return error object as value in place"
+//      /partial "Source may end mid-value, so leave any incomplete last value"
+//      /pieces "Scan in up to this many pieces, split at top-level newlines"
+//          [integer!]
 //      /file "File to be associated with BLOCK!s and GROUP!s in source"
 //          [file! url!]
 //      /line "Line number for start of scan, word variable will be updated"
@@ -2685,10 +3024,32 @@ REBNATIVE(transcode)
     // Return a block of the results, so [1] and [[1]] in those cases.
     //
     REBDSP dsp_orig = DSP;
-    if (REF(relax)) {
+    if (REF(partial)) {
+        //
+        // The position returned is where the incomplete value starts, so the
+        // caller can append more input there and TRANSCODE again.  This lets
+        // big data be loaded in bounded memory (see TRANSCODE-EACH).
+        //
+        if (REF(relax) or REF(pieces))
+            fail (Error_Bad_Refines_Raw());
+
+        Scan_To_Stack_Partial(&ss, REF(next) or REF(only));
+        ss.end = ss.begin;  // scanned up to here (the return position)
+    }
+    else if (REF(relax)) {
         ss.opts |= SCAN_FLAG_RELAX;
         Scan_To_Stack_Relaxed(&ss);
     }
+    else if (REF(pieces)) {
+        if (REF(next) or REF(only))
+            fail (Error_Bad_Refines_Raw());
+
+        REBINT pieces = VAL_INT32(ARG(pieces));
+        if (pieces <= 0)
+            fail (PAR(pieces));
+
+        Scan_To_Stack_Pieces(&ss, size, pieces);
+    }
     else
         Scan_To_Stack(&ss);
 
@@ -2722,7 +3083,13 @@ REBNATIVE(transcode)
     // operation consumed.
     //
     Move_Value(D_OUT, source);
-    if (not IS_NULLED(var) and (REF(next) or REF(only))) {
+    if (REF(partial)) {
+        if (IS_BINARY(source))
+            VAL_INDEX(D_OUT) = ss.begin - VAL_BIN_HEAD(source);
+        else
+            VAL_INDEX(D_OUT) += Num_Codepoints_For_Bytes(bp, ss.begin);
+    }
+    else if (not IS_NULLED(var) and (REF(next) or REF(only))) {
         if (IS_BINARY(source))
             VAL_INDEX(D_OUT) = ss.end - VAL_BIN_HEAD(source);
         else {
@@ -635,8 +635,12 @@ const REBYTE *Scan_Decimal(
 
     RESET_VAL_HEADER(out, REB_DECIMAL, CELL_MASK_NONE);
 
-    char *se;
-    VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
+    REBDEC d;
+    if (not Fast_Strtod(&d, buf)) {  // handles most inputs, see %f-float.c
+        char *se;
+        d = strtod(s_cast(buf), &se);
+    }
+    VAL_DECIMAL(out) = d;
 
     // !!! TBD: need check for NaN, and INF
 
@@ -1245,7 +1249,7 @@ const REBYTE *Scan_Binary(
 
     len -= 2;
 
-    cp = Decode_Binary(out, cp, len, base, '}');
+    cp = Decode_Binary(out, cp, len, base, '}', false);
     if (cp == NULL)
         return_NULL;
 
@@ -1152,6 +1152,8 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    Prune_Keylist_Cache();  // MAKE OBJECT! memoization mustn't outlive sweep
+
     REBLEN count = 0;
 
     if (sweeplist != NULL) {
@@ -688,6 +688,8 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
 
     if (delta == 0) return;
 
+    Unshare_Series_If_Shared(s);  // can't grow into the holder's allocation
+
     REBLEN used_old = SER_USED(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -900,6 +902,12 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     assert(IS_SER_ARRAY(a) == IS_SER_ARRAY(b));
     assert(SER_WIDE(a) == SER_WIDE(b));
 
+    // A copy-on-write series' LINK is its holder, which can't be swapped
+    // onto a series that isn't flagged as borrowing from it.
+    //
+    Unshare_Series_If_Shared(a);
+    Unshare_Series_If_Shared(b);
+
     // There are bits in the ->info and ->header which pertain to the content,
     // which includes whether the series is dynamic or if the data lives in
     // the node itself, the width (right 8 bits), etc.
@@ -948,6 +956,8 @@ void Remake_Series(REBSER *s, REBLEN units, REBYTE wide, REBFLGS flags)
 
     assert(NOT_SERIES_FLAG(s, FIXED_SIZE));
 
+    Unshare_Series_If_Shared(s);  // data_old is freed below
+
     bool was_dynamic = IS_SER_DYNAMIC(s);
 
     REBINT bias_old;
@@ -1038,7 +1048,14 @@ void Decay_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
-    if (IS_SER_DYNAMIC(s)) {
+    if (IS_SER_DYNAMIC(s) and GET_SERIES_INFO(s, SHARED)) {
+        //
+        // The data belongs to the holder (see Share_Series_Data()), and is
+        // freed when the GC finds that the holder has no borrowers left.
+        //
+        mutable_LEN_BYTE_OR_255(s) = 1;
+    }
+    else if (IS_SER_DYNAMIC(s)) {
         REBYTE wide = SER_WIDE(s);
         REBLEN bias = SER_BIAS(s);
         REBLEN total = (bias + SER_REST(s)) * wide;
@@ -1258,6 +1275,9 @@ REBLEN Check_Memory_Debug(void)
             if (not IS_SER_DYNAMIC(s))
                 continue; // data lives in the series node itself
 
+            if (GET_SERIES_INFO(s, SHARED))
+                continue; // data lives in a holder, maybe not at its head
+
             if (SER_REST(s) == 0)
                 panic (s); // zero size allocations not legal
 
@@ -25,6 +25,7 @@
 #include "sys-core.h"
 #include "sys-int-funcs.h"
 
+#define MIN_SHARED_BINARY_SIZE 256  // smaller copies are cheaper than holders
 
 
 //
@@ -188,6 +189,162 @@ REBSER *Copy_Sequence_At_Len_Extra(
 }
 
 
+//
+//  Borrow_Series_Data: C
+//
+static void Borrow_Series_Data(
+    REBSER *s,
+    REBSER *holder,
+    REBYTE *data,
+    REBLEN used
+){
+    mutable_LEN_BYTE_OR_255(s) = 255;  // dynamic, whatever it was before
+    s->content.dynamic.data = cast(char*, data);
+    s->content.dynamic.used = used;
+    s->content.dynamic.rest = used + 1;  // only room for holder's terminator
+    s->content.dynamic.bias = 0;
+
+    LINK(s).custom.node = NOD(holder);
+    SET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK);
+    SET_SERIES_INFO(s, SHARED);
+}
+
+
+//
+//  Share_Series_Data: C
+//
+// Make the fresh series node `copy` see the data of `s` from `index` to the
+// tail, without copying it.  The first time `s` is shared its allocation is
+// handed off to a hidden holder series (along with the file and line, for
+// an array), and from then on `s` borrows from the holder just like `copy`
+// does.  Both are marked SERIES_INFO_SHARED, and whichever one is modified
+// first pays for the physical copy in Unshare_Series().
+//
+// Only a suffix can be lent out, since a borrower must see the holder's own
+// terminator at its tail.  The caller is responsible for checking that the
+// series is dynamic, managed, and not one whose data has other meaning to
+// the system (varlists, paramlists, pairlists, strings with bookmarks...)
+//
+void Share_Series_Data(REBSER *copy, REBSER *s, REBLEN index)
+{
+    assert(IS_SER_DYNAMIC(s) and NOT_SERIES_FLAG(s, FIXED_SIZE));
+    assert(GET_SERIES_FLAG(s, MANAGED));
+    assert(SER_WIDE(copy) == SER_WIDE(s) and index <= SER_USED(s));
+    assert(NOT_SERIES_INFO(copy, SHARED));
+
+    REBSER *holder;
+    if (GET_SERIES_INFO(s, SHARED))
+        holder = SER(LINK(s).custom.node);
+    else {
+        if (IS_SER_ARRAY(s))
+            holder = SER(Make_Array_Core(1, NODE_FLAG_MANAGED));
+        else
+            holder = Make_Series_Core(1, SER_WIDE(s), NODE_FLAG_MANAGED);
+
+        Swap_Series_Content(holder, s);  // holder now owns the allocation
+
+        if (IS_SER_ARRAY(s)) {
+            holder->header.bits |= (s->header.bits & ARRAY_MASK_HAS_FILE_LINE);
+            s->header.bits &= ~ARRAY_MASK_HAS_FILE_LINE;
+        }
+
+        // The data pointer `s` had doesn't move, so C code that was already
+        // walking it (e.g. the evaluator running the block) is unaffected.
+        //
+        Borrow_Series_Data(s, holder, SER_DATA_RAW(holder), SER_USED(holder));
+    }
+
+    Borrow_Series_Data(
+        copy,
+        holder,
+        SER_DATA_RAW(s) + index * SER_WIDE(s),
+        SER_USED(s) - index
+    );
+}
+
+
+//
+//  Unshare_Series: C
+//
+// Give a copy-on-write series its own allocation, with a copy of the data it
+// was borrowing (see Share_Series_Data()).  There's no count of borrowers,
+// so the holder is left as-is for any others...the last one to write copies
+// too, and the holder is freed when the GC finds nothing borrowing from it.
+//
+void Unshare_Series(REBSER *s)
+{
+    assert(GET_SERIES_INFO(s, SHARED));
+
+    REBSER *holder = SER(LINK(s).custom.node);
+    char *data = s->content.dynamic.data;
+    REBLEN used = SER_USED(s);
+    REBYTE wide = SER_WIDE(s);
+
+    if (not Did_Series_Data_Alloc(s, used + 1)) {
+        s->content.dynamic.data = data;  // still validly shared
+        fail (Error_No_Memory((used + 1) * wide));
+    }
+    CLEAR_SERIES_INFO(s, SHARED);
+
+    if (IS_SER_ARRAY(s)) {
+        Prep_Array(ARR(s), 0);  // not FIXED_SIZE, so capacity doesn't matter
+        memcpy(s->content.dynamic.data, data, used * wide);
+        TERM_ARRAY_LEN(ARR(s), used);
+    }
+    else {
+        memcpy(s->content.dynamic.data, data, used * wide);
+        TERM_SEQUENCE_LEN(s, used);
+    }
+
+    if (IS_SER_ARRAY(s) and GET_ARRAY_FLAG(holder, HAS_FILE_LINE_UNMASKED)) {
+        LINK_FILE_NODE(s) = LINK_FILE_NODE(holder);
+        MISC(s).line = MISC(holder).line;
+        SET_ARRAY_FLAG(s, HAS_FILE_LINE_UNMASKED);  // LINK still needs mark
+    }
+    else {
+        CLEAR_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK);
+        TRASH_POINTER_IF_DEBUG(LINK(s).trash);
+    }
+}
+
+
+//
+//  Copy_Sequence_Shared_Managed: C
+//
+// COPY/SHARE of a BINARY!.  If the part being copied is large and runs to the
+// tail, the result borrows the bytes of `s` until either is modified (see
+// Share_Series_Data()).  Otherwise this is just an ordinary copy.
+//
+// Strings aren't shared, because their LINK() holds UTF-8 bookmarks and the
+// MISC() holds a codepoint count, which can't be lent out like the data.
+//
+REBSER *Copy_Sequence_Shared_Managed(REBSER *s, REBLEN index, REBLEN len)
+{
+    if (
+        index + len == SER_USED(s)
+        and len >= MIN_SHARED_BINARY_SIZE
+        and SER_WIDE(s) == 1
+        and IS_SER_DYNAMIC(s)
+        and GET_SERIES_FLAG(s, MANAGED)
+        and NOT_SERIES_FLAG(s, FIXED_SIZE)
+        and NOT_SERIES_FLAG(s, IS_STRING)
+        and NOT_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK)
+        and (
+            NOT_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK)
+            or GET_SERIES_INFO(s, SHARED)
+        )
+    ){
+        REBSER *copy = Make_Series_Core(1, sizeof(REBYTE), NODE_FLAG_MANAGED);
+        Share_Series_Data(copy, s, index);
+        return copy;
+    }
+
+    REBSER *copy = Copy_Sequence_At_Len(s, index, len);
+    Manage_Series(copy);
+    return copy;
+}
+
+
 //
 //  Remove_Series_Units: C
 //
@@ -200,6 +357,8 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBINT quantity)
     if (quantity == 0)
         return;
 
+    Unshare_Series_If_Shared(s);
+
     bool is_dynamic = IS_SER_DYNAMIC(s);
     REBLEN used_old = SER_USED(s);
 
@@ -316,6 +475,8 @@ void Remove_Series_Len(REBSER *s, REBLEN index, REBINT len)
 //
 void Unbias_Series(REBSER *s, bool keep)
 {
+    Unshare_Series_If_Shared(s);  // also covers Reset_Array(), Clear_Series()
+
     REBLEN bias = SER_BIAS(s);
     if (bias == 0)
         return;
@@ -206,7 +206,7 @@ REBNATIVE(bind)
         Init_Any_Array(D_OUT, VAL_TYPE(v), copy);
     }
     else {
-        at = VAL_ARRAY_AT(v); // only affects binding from current index
+        at = VAL_ARRAY_AT_UNSHARED(v); // only binds from current index
         Move_Value(D_OUT, v);
     }
 
@@ -287,7 +287,7 @@ REBNATIVE(in)
 
     // Special form: IN object block
     if (IS_BLOCK(word) or IS_GROUP(word)) {
-        Bind_Values_Deep(VAL_ARRAY_HEAD(word), context);
+        Bind_Values_Deep(VAL_ARRAY_HEAD_UNSHARED(word), context);
         Quotify(word, num_quotes);
         RETURN (word);
     }
@@ -467,7 +467,7 @@ REBNATIVE(unbind)
     if (ANY_WORD(word))
         Unbind_Any_Word(word);
     else
-        Unbind_Values_Core(VAL_ARRAY_AT(word), NULL, REF(deep));
+        Unbind_Values_Core(VAL_ARRAY_AT_UNSHARED(word), NULL, REF(deep));
 
     RETURN (word);
 }
@@ -1154,6 +1154,7 @@ REBNATIVE(as)
 
                     ++num_codepoints;
                 }
+                Unshare_Series_If_Shared(bin);  // LINK becomes bookmarks
                 SET_SERIES_FLAG(bin, IS_STRING);
                 SET_SERIES_FLAG(bin, UTF8_NONWORD);
                 str = STR(bin);
@@ -1251,6 +1252,7 @@ REBNATIVE(as)
                 // Constrain the input in the way it would be if we were doing
                 // the more efficient reuse.
                 //
+                Unshare_Series_If_Shared(bin);  // strings use LINK, MISC
                 SET_SERIES_FLAG(bin, IS_STRING);  // might be set already
                 Freeze_Sequence(bin);
             }
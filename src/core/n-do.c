@@ -797,7 +797,7 @@ REBNATIVE(applique)
     //
     Bind_Values_Inner_Loop(
         &binder,
-        VAL_ARRAY_HEAD(ARG(def)), // !!! bindings are mutated!  :-(
+        VAL_ARRAY_HEAD_UNSHARED(ARG(def)), // !!! bindings are mutated!  :-(
         exemplar,
         FLAGIT_KIND(REB_SET_WORD), // types to bind (just set-word!),
         0, // types to "add midstream" to binding as we go (nothing)
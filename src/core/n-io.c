@@ -42,6 +42,24 @@ REBNATIVE(form)
 }
 
 
+//
+//  Mold_Sink_Value: C
+//
+// Sink used by MOLD/SINK.  Each chunk is copied out as a BINARY! before any
+// code runs, since the WRITE or the callback may mold and move the buffer.
+//
+static void Mold_Sink_Value(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size)
+{
+    REBVAL *sink = cast(REBVAL*, mo->sink_data);
+    REBVAL *chunk = rebSizedBinary(utf8, size);
+
+    if (IS_PORT(sink))
+        rebElide("write", sink, rebR(chunk), rebEND);
+    else
+        rebElide(sink, rebR(chunk), rebEND);
+}
+
+
 //
 //  mold: native [
 //
@@ -54,9 +72,15 @@ REBNATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /sink "Write UTF-8 to a port (or pass to a function) in chunks"
+//          [port! action!]
 //  ]
 //
 REBNATIVE(mold)
+//
+// Plain MOLD accumulates the whole result in the mold buffer and then copies
+// it out.  MOLD/SINK hands off the buffer every MOLD_SINK_CHUNK bytes (at
+// value boundaries), so memory use doesn't grow with the size of the output.
 {
     INCLUDE_PARAMS_OF_MOLD;
 
@@ -66,9 +90,16 @@ REBNATIVE(mold)
     if (REF(flat))
         SET_MOLD_FLAG(mo, MOLD_FLAG_INDENT);
     if (REF(limit)) {
+        if (REF(sink))
+            fail (Error_Bad_Refines_Raw());
+
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(sink)) {
+        mo->sink = &Mold_Sink_Value;
+        mo->sink_data = ARG(sink);
+    }
 
     Push_Mold(mo);
 
@@ -77,6 +108,12 @@ REBNATIVE(mold)
 
     Mold_Value(mo, ARG(value));
 
+    if (REF(sink)) {
+        Flush_Mold(mo);
+        Drop_Mold(mo);
+        return nullptr;
+    }
+
     return Init_Text(D_OUT, Pop_Molded_String(mo));
 }
 
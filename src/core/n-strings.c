@@ -75,9 +75,20 @@ REBNATIVE(delimit)
 //          [any-value!]
 //      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
 //          [word!]
+//      /level "0 (store only) to 9 (smallest but slowest), default is 6"
+//          [integer!]
+//      /strategy "FILTERED, HUFFMAN-ONLY, RLE, or FIXED (zlib's tunings)"
+//          [word!]
+//      /blocks "Compress pieces of this many bytes independently (as pigz)"
+//          [integer!]
 //  ]
 //
 REBNATIVE(deflate)
+//
+// FILTERED suits data from predictors (e.g. PNG rows), HUFFMAN-ONLY and RLE
+// trade ratio for speed, and FIXED avoids the cost of dynamic trees on very
+// small inputs.  /BLOCKS gives a stream that a decoder can't tell from one
+// made by a single compressor, but with each block done on its own.
 {
     INCLUDE_PARAMS_OF_DEFLATE;
 
@@ -101,12 +112,45 @@ REBNATIVE(deflate)
         }
     }
 
+    int level = -1;  // zlib's Z_DEFAULT_COMPRESSION
+    if (REF(level)) {
+        level = Int32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
+    REBSTR *strategy = nullptr;
+    if (REF(strategy)) {
+        strategy = VAL_WORD_SPELLING(ARG(strategy));
+        switch (STR_SYMBOL(strategy)) {
+          case SYM_DEFAULT:
+          case SYM_FILTERED:
+          case SYM_HUFFMAN_ONLY:
+          case SYM_RLE:
+          case SYM_FIXED:
+            break;
+
+          default:
+            fail (PAR(strategy));
+        }
+    }
+
+    size_t block_size = 0;
+    if (REF(blocks)) {
+        if (VAL_INT64(ARG(blocks)) <= 0)
+            fail (PAR(blocks));
+        block_size = cast(size_t, VAL_INT64(ARG(blocks)));
+    }
+
     size_t compressed_size;
     void *compressed = Compress_Alloc_Core(
         &compressed_size,
         bp,
         size,
-        envelope
+        envelope,
+        level,
+        strategy,
+        block_size
     );
 
     return rebRepossess(compressed, compressed_size);
@@ -184,9 +228,16 @@ REBNATIVE(inflate)
 //      value [binary! text!]
 //      /base "The base to convert from: 64, 16, or 2 (defaults to 64)"
 //          [integer!]
+//      /partial "Stop before any incomplete last group, set word to the rest"
+//          [any-word!]
 //  ]
 //
 REBNATIVE(debase)
+//
+// /PARTIAL is for input that arrives in chunks: the position of any digits
+// which didn't add up to a whole byte (or a whole group of 3 bytes, for
+// base-64) is stored in the variable, so it can be prepended to the next
+// chunk.  Input that ends in a complete group gives the tail position.
 {
     INCLUDE_PARAMS_OF_DEBASE;
 
@@ -199,9 +250,21 @@ REBNATIVE(debase)
     else
         base = 64;
 
-    if (!Decode_Binary(D_OUT, bp, size, base, 0))
+    const REBYTE *ep = Decode_Binary(
+        D_OUT, bp, size, base, 0, REF(partial)
+    );
+    if (not ep)
         fail (Error_Invalid_Data_Raw(ARG(value)));
 
+    if (REF(partial)) {
+        REBVAL *rest = Sink_Var_May_Fail(ARG(partial), SPECIFIED);
+        Move_Value(rest, ARG(value));
+        if (IS_BINARY(rest))
+            VAL_INDEX(rest) += ep - bp;
+        else
+            VAL_INDEX(rest) += Num_Codepoints_For_Bytes(bp, ep);
+    }
+
     return D_OUT;
 }
 
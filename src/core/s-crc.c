@@ -322,12 +322,10 @@ uint32_t Hash_Value(const RELVAL *v)
         // Note that the canon symbol may change for a group of word synonyms
         // if that canon is GC'd--it picks another synonym.  Thus the pointer
         // of the canon cannot be used as a long term hash.  A case insensitive
-        // hashing of the word spelling itself is needed.
+        // hashing of the word spelling itself is needed...but the canon has
+        // that cached (and passes it on to any synonym that replaces it).
         //
-        // !!! Should this hash be cached on the words somehow, e.g. in the
-        // data payload before the actual string?
-        //
-        hash = Hash_String(VAL_WORD_SPELLING(cell));
+        hash = MISC(VAL_WORD_CANON(cell)).hash;
         break; }
 
       case REB_ACTION:
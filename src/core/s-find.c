@@ -115,15 +115,62 @@ REBINT Compare_Uni_Str(
     REBLEN len,
     bool uncase
 ){
-    REBCHR(const*) u1 = cast(REBCHR(const*), bp1);
-    REBCHR(const*) u2 = cast(REBCHR(const*), bp2);
+    const REBINT word = sizeof(uintptr_t);
+
+    while (len > 0) {
+        //
+        // Skip words which are the same (after lowercasing, if uncased) as
+        // long as they're ASCII in both strings.  There are at least `len`
+        // bytes left in each, since every codepoint is at least one byte.
+        //
+      #ifdef CPU_X86_SSE2
+        if (len >= 16) {
+            __m128i x1 = _mm_loadu_si128(cast(const __m128i*, bp1));
+            __m128i x2 = _mm_loadu_si128(cast(const __m128i*, bp2));
+            if (_mm_movemask_epi8(_mm_or_si128(x1, x2)) == 0) {  // ASCII
+                if (uncase) {
+                    x1 = Sse2_Lower_Ascii(x1);
+                    x2 = Sse2_Lower_Ascii(x2);
+                }
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(x1, x2)) == 0xFFFF) {
+                    bp1 += 16;
+                    bp2 += 16;
+                    len -= 16;
+                    continue;
+                }
+            }
+        }
+      #endif
+        if (len >= cast(REBLEN, word)) {
+            uintptr_t w1 = Swar_Load(bp1);
+            uintptr_t w2 = Swar_Load(bp2);
+            if (not ((w1 | w2) & SWAR_HIGHS) and (
+                w1 == w2
+                or (uncase and Swar_Lower_Ascii(w1) == Swar_Lower_Ascii(w2))
+            )){
+                bp1 += word;
+                bp2 += word;
+                len -= word;
+                continue;
+            }
+        }
 
-    for (; len > 0; len--) {
         REBUNI c1;
         REBUNI c2;
 
-        u1 = NEXT_CHR(&c1, u1);
-        u2 = NEXT_CHR(&c2, u2);
+        if (*bp1 < 0x80)
+            c1 = *bp1;
+        else
+            bp1 = Back_Scan_UTF8_Char(&c1, bp1, NULL);
+        ++bp1;
+
+        if (*bp2 < 0x80)
+            c2 = *bp2;
+        else
+            bp2 = Back_Scan_UTF8_Char(&c2, bp2, NULL);
+        ++bp2;
+
+        --len;
 
         REBINT d;
         if (uncase)
@@ -196,7 +243,33 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
     REBSIZ l1 = LEN_BYTES(s1);
     REBINT result = 0;
 
+    const REBSIZ word = sizeof(uintptr_t);
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
+        //
+        // Skip whole words of ASCII which are the same.  Words differing
+        // only in case can be skipped too, once a case difference is known,
+        // since only the first one decides the result.
+        //
+        while (l1 >= word and l2 >= word) {
+            uintptr_t w1 = Swar_Load(s1);
+            uintptr_t w2 = Swar_Load(s2);
+            if ((w1 | w2) & SWAR_HIGHS)
+                break;
+            if (w1 != w2) {
+                if (result == 0)
+                    break;
+                if (Swar_Lower_Ascii(w1) != Swar_Lower_Ascii(w2))
+                    break;
+            }
+            s1 += word;
+            s2 += word;
+            l1 -= word;
+            l2 -= word;
+        }
+        if (l1 == 0 or l2 == 0)
+            break;
+
         c1 = *s1;
         c2 = *s2;
         if (c1 > 127) {
@@ -223,6 +296,238 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
 }
 
 
+// Boyer-Moore-Horspool has to fill in a 256 entry table before searching,
+// which isn't worth it for short data.  It also does poorly on patterns too
+// short to skip far when they mismatch (memchr() is better for those).
+//
+#define MIN_HORSPOOL_PATTERN 8
+#define MIN_HORSPOOL_DATA 1024
+
+
+//
+//  Find_Bytes: C
+//
+// Search for an exact run of bytes, returning a pointer to the first match
+// or nullptr.  For short patterns the filter is the first and last bytes of
+// the pattern, checked at 16 positions at once with SSE2 (on x86-64) and then
+// with memchr() on the first byte, before comparing the rest.  Long patterns
+// in long data use Boyer-Moore-Horspool instead, whose skip table lets each
+// mismatch move ahead by up to the length of the pattern.
+//
+static const REBYTE *Find_Bytes(
+    const REBYTE *bp1,
+    REBSIZ size1,
+    const REBYTE *bp2,
+    REBSIZ size2
+){
+    assert(size2 != 0);
+    if (size2 > size1)
+        return nullptr;
+
+    REBSIZ last = size1 - size2;  // last offset a match could start at
+    REBYTE last2 = bp2[size2 - 1];
+    REBSIZ i = 0;
+
+    if (size2 >= MIN_HORSPOOL_PATTERN and size1 >= MIN_HORSPOOL_DATA) {
+        REBSIZ shift[256];
+        REBLEN n;
+        for (n = 0; n < 256; ++n)
+            shift[n] = size2;
+        for (n = 0; n < size2 - 1; ++n)
+            shift[bp2[n]] = size2 - 1 - n;
+
+        while (i <= last) {
+            REBYTE b = bp1[i + size2 - 1];
+            if (b == last2 and memcmp(bp1 + i, bp2, size2 - 1) == 0)
+                return bp1 + i;
+            i += shift[b];
+        }
+        return nullptr;
+    }
+
+  #ifdef CPU_X86_SSE2
+    if (size2 > 1) {  // else the first byte is the last, and memchr() is fine
+        __m128i firsts = _mm_set1_epi8(cast(char, bp2[0]));
+        __m128i lasts = _mm_set1_epi8(cast(char, last2));
+
+        for (; i + 16 <= last + 1; i += 16) {  // reads up to bp1[last + 15]
+            __m128i a = _mm_loadu_si128(cast(const __m128i*, bp1 + i));
+            __m128i b = _mm_loadu_si128(
+                cast(const __m128i*, bp1 + i + size2 - 1)
+            );
+            unsigned mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(a, firsts),
+                _mm_cmpeq_epi8(b, lasts)
+            ));
+            REBSIZ at;
+            for (at = i; mask != 0; mask >>= 1, ++at) {
+                if (
+                    (mask & 1)
+                    and memcmp(bp1 + at + 1, bp2 + 1, size2 - 2) == 0
+                ){
+                    return bp1 + at;
+                }
+            }
+        }
+    }
+  #endif
+
+    while (i <= last) {
+        const REBYTE *first = cast(const REBYTE*,
+            memchr(bp1 + i, bp2[0], last - i + 1)
+        );
+        if (not first)
+            return nullptr;
+        if (
+            first[size2 - 1] == last2
+            and memcmp(first + 1, bp2 + 1, size2 - 1) == 0
+        ){
+            return first;
+        }
+        i = (first - bp1) + 1;
+    }
+    return nullptr;
+}
+
+
+//
+//  Skip_To_Uncased_Candidate: C
+//
+// For caseless search in UTF-8, find the first byte in [bp, end) that might
+// begin a match of a codepoint whose lowercase is `c2_canon`, or `end`.
+// Non-ASCII bytes are always candidates (KELVIN SIGN lowercases to `k`), but
+// the only ASCII candidates are the two cases of `c2_canon`.  Runs of other
+// ASCII bytes are skipped 16 at a time with SSE2 (on x86-64), then a word at
+// a time, without looking at them individually.
+//
+static const REBYTE *Skip_To_Uncased_Candidate(
+    const REBYTE *bp,
+    const REBYTE *end,
+    REBUNI c2_canon
+){
+    REBYTE lower = 0x80;  // not ASCII, so only non-ASCII bytes are candidates
+    REBYTE upper = 0x80;
+    if (c2_canon < 0x80) {
+        lower = c2_canon;
+        upper = UP_CASE(c2_canon);
+    }
+
+  #ifdef CPU_X86_SSE2
+    __m128i lowers16 = _mm_set1_epi8(cast(char, lower));
+    __m128i uppers16 = _mm_set1_epi8(cast(char, upper));
+    while (end - bp >= 16) {
+        __m128i x = _mm_loadu_si128(cast(const __m128i*, bp));
+        unsigned mask = _mm_movemask_epi8(_mm_or_si128(
+            x,  // the high bit of a non-ASCII byte is all movemask looks at
+            _mm_or_si128(
+                _mm_cmpeq_epi8(x, lowers16),
+                _mm_cmpeq_epi8(x, uppers16)
+            )
+        ));
+        if (mask != 0) {
+            for (; not (mask & 1); mask >>= 1)
+                ++bp;
+            return bp;
+        }
+        bp += 16;
+    }
+  #endif
+
+    uintptr_t lowers = SWAR_ONES * lower;
+    uintptr_t uppers = SWAR_ONES * upper;
+    while (end - bp >= cast(REBINT, sizeof(uintptr_t))) {
+        uintptr_t w = Swar_Load(bp);
+        if (
+            (w & SWAR_HIGHS)
+            or SWAR_HAS_ZERO_BYTE(w ^ lowers)
+            or SWAR_HAS_ZERO_BYTE(w ^ uppers)
+        ){
+            break;  // the candidate is somewhere in this word
+        }
+        bp += sizeof(uintptr_t);
+    }
+
+    for (; bp != end; ++bp) {
+        if (*bp >= 0x80 or *bp == lower or *bp == upper)
+            break;
+    }
+    return bp;
+}
+
+
+//
+//  Match_Uncased: C
+//
+// Caselessly compare UTF-8 data at `bp1` with a (valid UTF-8) pattern.  The
+// data may be arbitrary binary, with invalid UTF-8 counting as a mismatch.
+// `end1` is just a limit on how far ahead it's safe to read words.  Stretches
+// that are ASCII in both are compared a word at a time, lowercased in place.
+//
+static bool Match_Uncased(
+    const REBYTE *bp1,
+    const REBYTE *end1,
+    const REBYTE *bp2,
+    const REBYTE *end2
+){
+    const REBINT word = sizeof(uintptr_t);
+
+    while (bp2 != end2) {
+        if (end2 - bp2 >= word and end1 - bp1 >= word) {
+            uintptr_t w1 = Swar_Load(bp1);
+            uintptr_t w2 = Swar_Load(bp2);
+            if (not ((w1 | w2) & SWAR_HIGHS)) {
+                if (Swar_Lower_Ascii(w1) != Swar_Lower_Ascii(w2))
+                    return false;
+                bp1 += word;
+                bp2 += word;
+                continue;
+            }
+        }
+
+        if (bp1 == end1)
+            return false;
+
+        REBUNI c1;
+        if (*bp1 < 0x80)
+            c1 = *bp1;
+        else {
+            bp1 = Back_Scan_UTF8_Char(&c1, bp1, NULL);
+            if (bp1 == NULL)
+                return false;
+        }
+        ++bp1;  // needed: see notes on why it's called "Back_Scan"
+
+        REBUNI c2;
+        if (*bp2 < 0x80)
+            c2 = *bp2;
+        else
+            bp2 = Back_Scan_UTF8_Char(&c2, bp2, NULL);
+        ++bp2;
+
+        if (c1 != c2 and LO_CASE(c1) != LO_CASE(c2))
+            return false;
+    }
+
+    return true;
+}
+
+
+//
+//  Count_Codepoints: C
+//
+// Count the codepoints in valid UTF-8 data by counting the bytes which are
+// not continuation bytes.  Unlike stepping through the data a codepoint at a
+// time, this loop has no branches for the compiler to stop vectorizing at.
+//
+static REBLEN Count_Codepoints(const REBYTE *bp, const REBYTE *end)
+{
+    REBLEN count = 0;
+    for (; bp != end; ++bp)
+        count += ((*bp & 0xC0) != 0x80);
+    return count;
+}
+
+
 //
 //  Find_Bin_In_Bin: C
 //
@@ -245,23 +550,16 @@ REBLEN Find_Bin_In_Bin(
     REBYTE *bp1 = BIN_AT(series, offset);
     REBLEN size1 = BIN_LEN(series) - offset;
 
-    REBYTE *end1 = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
-
-    REBYTE b2 = *bp2; // first byte
-
-    while (bp1 != end1) {
-        if (*bp1 == b2) { // matched first byte
-            REBLEN n;
-            for (n = 1; n < size2; n++) {
-                if (bp1[n] != bp2[n])
-                    break;
-            }
-            if (n == size2)
-                return bp1 - BIN_HEAD(series);
-        }
-        ++bp1;
+    if (not (flags & AM_FIND_MATCH)) {
+        const REBYTE *found = Find_Bytes(bp1, size1, bp2, size2);
+        if (not found)
+            return NOT_FOUND;
+        return found - BIN_HEAD(series);
     }
 
+    if (memcmp(bp1, bp2, size2) == 0)  // AM_FIND_MATCH only checks here
+        return offset;
+
     return NOT_FOUND;
 }
 
@@ -310,54 +608,34 @@ REBLEN Find_Str_In_Bin(
 
     const REBYTE *end1
         = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
+    const REBYTE *tail1 = BIN_TAIL(series);
+
+    UNUSED(len2);  // Match_Uncased() goes by the size of the pattern instead
 
     REBUNI c2_canon; // first codepoint, but only calculate lowercase once
-    REBCHR(const*) next2 = cast(REBCHR(const*), bp2);  // guaranteed valid
-    next2 = NEXT_CHR(&c2_canon, next2);
+    NEXT_CHR(&c2_canon, cast(REBCHR(const*), bp2));  // guaranteed valid
     c2_canon = LO_CASE(c2_canon);
 
     while (bp1 < end1) {
-        const REBYTE *next1;
-        REBUNI c1;
-        if (*bp1 < 0x80) {
-            c1 = *bp1;
-            next1 = bp1;
-        }
-        else {
-            next1 = Back_Scan_UTF8_Char(&c1, bp1, NULL);
-            if (next1 == NULL) {
-                ++bp1;
-                continue; // treat bad scans just as this byte not matching
-            }
+        if (not (flags & AM_FIND_MATCH)) {
+            bp1 = Skip_To_Uncased_Candidate(bp1, end1, c2_canon);
+            if (bp1 == end1)
+                break;
         }
-        ++next1; // needed: see notes on why it's called "Back_Scan"
-
-        if (LO_CASE(c1) == c2_canon) { // matched first char
-            const REBYTE *temp1 = next1;
-            REBCHR(const*) temp2 = next2;
 
-            REBLEN n;
-            for (n = 1; n < len2; n++) {
-                if (*temp1 < 0x80)
-                    c1 = *temp1;
-                else {
-                    temp1 = Back_Scan_UTF8_Char(&c1, temp1, NULL);
-                    if (temp1 == NULL)
-                        break; // again, treat bad scans same as no match
-                }
-                ++temp1; // needed: see notes on why it's called "Back_Scan"
+        if (Match_Uncased(bp1, tail1, bp2, bp2 + size2))
+            return bp1 - BIN_HEAD(series);
 
-                REBUNI c2;
-                temp2 = NEXT_CHR(&c2, temp2);
-
-                if (LO_CASE(c1) != LO_CASE(c2))
-                    break;
-            }
-            if (n == len2)
-                return bp1 - BIN_HEAD(series);
+        if (*bp1 < 0x80)
+            ++bp1;
+        else {
+            REBUNI c1;
+            const REBYTE *next1 = Back_Scan_UTF8_Char(&c1, bp1, NULL);
+            if (next1 == NULL)
+                ++bp1;  // treat bad scans just as this byte not matching
+            else
+                bp1 = next1 + 1;  // see notes on why it's called "Back_Scan"
         }
-
-        bp1 = next1;
     }
 
     return NOT_FOUND;
@@ -401,6 +679,61 @@ REBLEN Find_Str_In_Str(
 
     bool uncase = not (flags & AM_FIND_CASE); // case insenstive
 
+    if (skip == 1 and not (flags & AM_FIND_MATCH) and len != 0) {
+        if (index >= end)
+            return NOT_FOUND;
+
+        // Forward searches are the common case (including PARSE's TO and
+        // THRU, and REPLACE), and are done on the UTF-8 bytes.  A match
+        // must start before `end`, but may run past it.
+        //
+        const REBYTE *bp1 = cast(REBYTE*, STR_AT(str1, index));
+        const REBYTE *end1 = cast(REBYTE*, STR_AT(str1, end));
+        const REBYTE *tail1 = cast(REBYTE*, STR_TAIL(str1));
+
+        const REBYTE *bp2 = cast(REBYTE*, STR_AT(str2, index2));
+        const REBYTE *end2 = cast(REBYTE*, STR_AT(str2, index2 + len));
+
+        if (not uncase) {
+            //
+            // UTF-8 is self-synchronizing, so a byte match of a valid UTF-8
+            // pattern is always on codepoint boundaries.
+            //
+            REBSIZ size2 = end2 - bp2;
+            REBSIZ size1 = MIN(
+                cast(REBSIZ, tail1 - bp1),
+                cast(REBSIZ, end1 - bp1) + size2 - 1
+            );
+            const REBYTE *found = Find_Bytes(bp1, size1, bp2, size2);
+            if (not found)
+                return NOT_FOUND;
+            return index + Count_Codepoints(bp1, found);
+        }
+
+        REBUNI c2_canon;
+        NEXT_CHR(&c2_canon, cast(REBCHR(const*), bp2));
+        c2_canon = LO_CASE(c2_canon);
+
+        while (bp1 != end1) {
+            const REBYTE *candidate
+                = Skip_To_Uncased_Candidate(bp1, end1, c2_canon);
+            index += candidate - bp1;  // skipped bytes are all ASCII
+            bp1 = candidate;
+            if (bp1 == end1)
+                break;
+
+            if (Match_Uncased(bp1, tail1, bp2, end2))
+                return index;
+
+            do {
+                ++bp1;
+            } while ((*bp1 & 0xC0) == 0x80);  // skip continuation bytes
+            ++index;
+        }
+
+        return NOT_FOUND;
+    }
+
     REBUNI c2_canon; // calculate first char lowercase once, vs. each step
     REBCHR(const*) next2 = STR_AT(str2, index2);
     next2 = NEXT_CHR(&c2_canon, next2);
@@ -557,6 +890,20 @@ REBLEN Find_Bin_Bitset(
 
     assert((flags & ~AM_FIND_MATCH) == 0); // no AM_FIND_CASE
 
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {  // the usual FIND
+        if (offset >= tail)
+            return NOT_FOUND;
+
+        const bool uncase = false;
+        const bool want = false;  // skip over the bytes *not* in the set
+        REBLEN n = Span_Bitset_Bytes(
+            BIN_AT(bin, offset), tail - offset, bset, uncase, want
+        );
+        if (offset + n == cast(REBLEN, tail))
+            return NOT_FOUND;
+        return offset + n;
+    }
+
     REBYTE *bp1 = BIN_AT(bin, offset);
 
     while (skip < 0 ? offset >= head : offset < tail) {
@@ -607,6 +954,19 @@ REBLEN Find_Str_Bitset(
 
     bool uncase = not (flags & AM_FIND_CASE); // case insensitive
 
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {  // the usual FIND
+        if (index >= end)
+            return NOT_FOUND;
+
+        const bool want = false;  // skip over codepoints *not* in the set
+        REBLEN n = Span_Bitset_Utf8(
+            cast(REBYTE*, STR_AT(str, index)), end - index, bset, uncase, want
+        );
+        if (index + cast(REBINT, n) == end)
+            return NOT_FOUND;
+        return index + n;
+    }
+
     REBCHR(const*) cp1 = STR_AT(str, index);
     REBUNI c1;
     if (skip > 0)
@@ -93,7 +93,7 @@
 //
 REBYTE *Prep_Mold_Overestimated(REB_MOLD *mo, REBLEN num_bytes)
 {
-    REBLEN tail = STR_LEN(mo->series);
+    REBSIZ tail = STR_SIZE(mo->series);
     EXPAND_SERIES_TAIL(SER(mo->series), num_bytes);  // terminates at guess
     return BIN_AT(SER(mo->series), tail);
 }
@@ -162,9 +162,18 @@ void New_Indented_Line(REB_MOLD *mo)
 {
     // Check output string has content already but no terminator:
     //
+    // (A mold with a sink only looks at what it has written since the push
+    // point, as what came before was already handed to the sink.  But see
+    // Flush_Mold_If_Full() for why a trailing space is never handed over.)
+    //
     REBYTE *bp;
-    if (STR_LEN(mo->series) == 0)
+    if (
+        mo->sink != nullptr
+            ? STR_SIZE(mo->series) == mo->offset
+            : STR_LEN(mo->series) == 0
+    ){
         bp = nullptr;
+    }
     else {
         bp = BIN_LAST(SER(mo->series));  // legal way to check UTF-8
         if (*bp == ' ' or *bp == '\t')
@@ -285,6 +294,7 @@ void Mold_Array_At(
         first_item = false;
 
         Mold_Value(mo, item);
+        Flush_Mold_If_Full(mo);
 
         ++item;
         if (IS_END(item))
@@ -574,8 +584,10 @@ void Push_Mold(REB_MOLD *mo)
     mo->offset = STR_SIZE(mo->series);
     mo->index = STR_LEN(mo->series);
 
-    if (GET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT))
+    if (GET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT)) {
         assert(mo->limit != 0);  // !!! Should a limit of 0 be allowed?
+        assert(mo->sink == nullptr);  // limit is applied to the whole output
+    }
 
     if (
         GET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE)
@@ -777,6 +789,130 @@ void Drop_Mold_Core(
 }
 
 
+// The sink is passed to rebRescue(), so that if it fails the holds that
+// Flush_Mold_Core() put on the series being molded can be released.
+//
+struct Reb_Mold_Flush {
+    REB_MOLD *mo;
+    REBSIZ size;
+};
+
+static REBVAL *Call_Mold_Sink_Dangerous(struct Reb_Mold_Flush *flush)
+{
+    REB_MOLD *mo = flush->mo;
+    mo->sink(mo, BIN_AT(SER(mo->series), mo->offset), flush->size);
+    return nullptr;
+}
+
+
+//
+//  Flush_Mold_Core: C
+//
+// Hand `size` bytes of what was molded since the Push_Mold() to the mold's
+// sink, and move whatever is left after them back to the push point.
+//
+// A sink like a PORT! or ACTION! runs arbitrary code, while the molders up
+// the stack hold pointers into the arrays, objects and maps they're in the
+// middle of.  So each of those (the ones on TG_Mold_Stack) has a HOLD put on
+// it during the call, and code which tries to change one gets an error.
+//
+static void Flush_Mold_Core(REB_MOLD *mo, REBSIZ size)
+{
+    assert(mo->series != nullptr);  // if null, there was no Push_Mold()
+    assert(mo->sink != nullptr);
+
+    REBSIZ total = STR_SIZE(mo->series) - mo->offset;
+    assert(size <= total and total - size <= 1);  // held back at most 1 byte
+    if (size == 0)
+        return;
+
+    REBLEN depth = SER_LEN(TG_Mold_Stack);
+    REBSER *took_holds = nullptr;
+    REBLEN n;
+    for (n = 0; n < depth; ++n) {
+        REBSER *s = *SER_AT(REBSER*, TG_Mold_Stack, n);
+        if (GET_SERIES_INFO(s, HOLD))
+            continue;
+        if (took_holds == nullptr)
+            took_holds = Make_Series(depth, sizeof(REBSER*));
+        SET_SERIES_INFO(s, HOLD);
+        Push_Pointer_To_Series(took_holds, s);
+    }
+
+    struct Reb_Mold_Flush flush;
+    flush.mo = mo;
+    flush.size = size;
+
+    REBVAL *error = rebRescue(
+        cast(REBDNG*, &Call_Mold_Sink_Dangerous),
+        &flush
+    );
+
+    if (took_holds) {
+        for (n = 0; n < SER_LEN(took_holds); ++n) {
+            REBSER *s = *SER_AT(REBSER*, took_holds, n);
+            assert(GET_SERIES_INFO(s, HOLD));
+            CLEAR_SERIES_INFO(s, HOLD);
+        }
+        Free_Unmanaged_Series(took_holds);
+    }
+
+    if (error) {
+        REBCTX *ctx = VAL_CONTEXT(error);
+        rebRelease(error);
+        fail (ctx);
+    }
+
+    if (size == total)
+        TERM_STR_LEN_SIZE(mo->series, mo->index, mo->offset);
+    else {
+        REBYTE held = *BIN_LAST(SER(mo->series));  // ASCII space or tab
+        TERM_STR_LEN_SIZE(mo->series, mo->index, mo->offset);
+        Append_Codepoint(mo->series, held);
+    }
+}
+
+
+//
+//  Flush_Mold: C
+//
+// Hand everything molded since the Push_Mold() to the mold's sink, and then
+// reset the mold buffer to the push point.  The mold stays pushed, so this
+// can be done any number of times before the final Drop_Mold().
+//
+void Flush_Mold(REB_MOLD *mo)
+{
+    Flush_Mold_Core(mo, STR_SIZE(mo->series) - mo->offset);
+}
+
+
+//
+//  Flush_Mold_If_Full: C
+//
+// Called at value boundaries, where handing the output so far to the sink
+// won't split anything that later molding code might want to look back at.
+//
+// The exception is a trailing space or tab, which New_Indented_Line() would
+// turn into a newline.  That byte is kept in the buffer, so the output comes
+// out the same as if it had been molded without a sink.
+//
+void Flush_Mold_If_Full(REB_MOLD *mo)
+{
+    if (mo->sink == nullptr)
+        return;
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    if (size < MOLD_SINK_CHUNK)
+        return;
+
+    REBYTE last = *BIN_LAST(SER(mo->series));
+    if (last == ' ' or last == '\t')
+        --size;
+
+    Flush_Mold_Core(mo, size);
+}
+
+
 //
 //  Startup_Mold: C
 //
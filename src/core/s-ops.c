@@ -115,6 +115,49 @@ const REBYTE *Analyze_String_For_Scan(
 }
 
 
+//
+//  Xandor_Bytes: C
+//
+// Combine two runs of bytes for a bitwise set operation, a machine word at a
+// time (bitsets for wide Unicode ranges can be many kilobytes).  memcpy() is
+// used to load and store the words, since the data needn't be aligned--and
+// compilers turn that into plain loads and stores where that is legal.
+//
+static void Xandor_Bytes(
+    REBSYM sym,
+    REBYTE *out,
+    const REBYTE *p0,
+    const REBYTE *p1,
+    REBLEN len
+){
+    REBLEN i = 0;
+    for (; i + sizeof(uintptr_t) <= len; i += sizeof(uintptr_t)) {
+        uintptr_t w0;
+        uintptr_t w1;
+        memcpy(&w0, p0 + i, sizeof(uintptr_t));
+        memcpy(&w1, p1 + i, sizeof(uintptr_t));
+
+        uintptr_t w;
+        switch (sym) {
+          case SYM_INTERSECT: w = w0 & w1; break;
+          case SYM_UNION: w = w0 | w1; break;
+          case SYM_DIFFERENCE: w = w0 ^ w1; break;
+          default: assert(sym == SYM_EXCLUDE); w = w0 & ~w1; break;
+        }
+        memcpy(out + i, &w, sizeof(uintptr_t));
+    }
+
+    for (; i < len; ++i) {
+        switch (sym) {
+          case SYM_INTERSECT: out[i] = p0[i] & p1[i]; break;
+          case SYM_UNION: out[i] = p0[i] | p1[i]; break;
+          case SYM_DIFFERENCE: out[i] = p0[i] ^ p1[i]; break;
+          default: out[i] = p0[i] & ~p1[i]; break;
+        }
+    }
+}
+
+
 //
 //  Xandor_Binary: C
 //
@@ -141,6 +184,18 @@ REBSER *Xandor_Binary(const REBVAL *verb, REBVAL *value, REBVAL *arg)
 
     REBLEN t2 = MAX(t0, t1);
 
+    REBSYM sym = VAL_WORD_SYM(verb);
+    switch (sym) {
+      case SYM_INTERSECT:  // and
+      case SYM_UNION:  // or
+      case SYM_DIFFERENCE:  // xor
+      case SYM_EXCLUDE:  // !!! not a "type action", word manually in %words.r
+        break;
+
+      default:
+        fail (Error_Cannot_Use_Raw(verb, Datatype_From_Kind(REB_BINARY)));
+    }
+
     REBSER *series;
     if (IS_BITSET(value)) {
         //
@@ -162,41 +217,19 @@ REBSER *Xandor_Binary(const REBVAL *verb, REBVAL *value, REBVAL *arg)
 
     REBYTE *p2 = BIN_HEAD(series);
 
-    switch (VAL_WORD_SYM(verb)) {
-    case SYM_INTERSECT: { // and
-        REBLEN i;
-        for (i = 0; i < mt; i++)
-            *p2++ = *p0++ & *p1++;
-        CLEAR(p2, t2 - mt);
-        return series; }
-
-    case SYM_UNION: { // or
-        REBLEN i;
-        for (i = 0; i < mt; i++)
-            *p2++ = *p0++ | *p1++;
-        break; }
-
-    case SYM_DIFFERENCE: { // xor
-        REBLEN i;
-        for (i = 0; i < mt; i++)
-            *p2++ = *p0++ ^ *p1++;
-        break; }
-
-    case SYM_EXCLUDE: { // !!! not a "type action", word manually in %words.r
-        REBLEN i;
-        for (i = 0; i < mt; i++)
-            *p2++ = *p0++ & ~*p1++;
-        if (t0 > t1)
-            memcpy(p2, p0, t0 - t1); // residual from first only
-        return series; }
-
-    default:
-        fail (Error_Cannot_Use_Raw(verb, Datatype_From_Kind(REB_BINARY)));
-    }
+    Xandor_Bytes(sym, p2, p0, p1, mt);
 
-    // Copy the residual
+    // Bytes past the end of the shorter input act as if they were zero.
     //
-    memcpy(p2, ((t0 > t1) ? p0 : p1), t2 - mt);
+    if (
+        sym == SYM_INTERSECT
+        or (sym == SYM_EXCLUDE and t0 <= t1)
+    ){
+        CLEAR(p2 + mt, t2 - mt);
+    }
+    else
+        memcpy(p2 + mt, ((t0 > t1) ? p0 : p1) + mt, t2 - mt);
+
     return series;
 }
 
@@ -215,8 +248,16 @@ REBSER *Complement_Binary(REBVAL *value)
     TERM_SEQUENCE_LEN(bin, len);
 
     REBYTE *dp = BIN_HEAD(bin);
-    for (; len > 0; len--, ++bp, ++dp)
-        *dp = ~(*bp);
+
+    REBLEN i = 0;
+    for (; i + sizeof(uintptr_t) <= len; i += sizeof(uintptr_t)) {
+        uintptr_t w;  // a word at a time, see Xandor_Bytes()
+        memcpy(&w, bp + i, sizeof(uintptr_t));
+        w = ~w;
+        memcpy(dp + i, &w, sizeof(uintptr_t));
+    }
+    for (; i < len; ++i)
+        dp[i] = ~bp[i];
 
     return bin;
 }
@@ -303,33 +344,47 @@ void Change_Case(
     // be possible, only contractions (is that true?)  Review when UTF-8
     // Everywhere is more mature to the point this is worth worrying about.
     //
-    REBCHR(*) up = VAL_STRING_AT(val);
-    REBCHR(*) dp;
-    if (upper) {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, UP_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+    // Runs of ASCII are changed in place 16 bytes (with SSE2) or a machine
+    // word at a time, and only the codepoints outside them are decoded and
+    // re-encoded.
+    //
+    REBYTE *bp = cast(REBYTE*, VAL_STRING_AT(val));
+    const REBYTE *tail = cast(REBYTE*, STR_TAIL(VAL_STRING(val)));
+    const REBINT word = sizeof(uintptr_t);
+
+    while (len > 0) {
+        REBLEN run = Ascii_Run_Size(bp, tail);  // bytes, same as codepoints
+        if (run > len)
+            run = len;
+        len -= run;
+
+      #ifdef CPU_X86_SSE2
+        for (; run >= 16; run -= 16, bp += 16) {
+            __m128i x = _mm_loadu_si128(cast(__m128i*, bp));
+            x = upper ? Sse2_Upper_Ascii(x) : Sse2_Lower_Ascii(x);
+            _mm_storeu_si128(cast(__m128i*, bp), x);
         }
-    }
-    else {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, LO_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+      #endif
+        for (; run >= cast(REBLEN, word); run -= word, bp += word) {
+            uintptr_t w = Swar_Load(bp);
+            w = upper ? Swar_Upper_Ascii(w) : Swar_Lower_Ascii(w);
+            memcpy(bp, &w, sizeof(uintptr_t));
         }
+        for (; run > 0; --run, ++bp)
+            *bp = cast(REBYTE, upper ? UP_CASE(*bp) : LO_CASE(*bp));
+
+        if (len == 0)
+            break;
+
+        REBCHR(*) dp = cast(REBCHR(*), bp);
+        REBUNI c;
+        REBCHR(*) up = NEXT_CHR(&c, dp);
+        if (c < UNICODE_CASES) {
+            dp = WRITE_CHR(dp, upper ? UP_CASE(c) : LO_CASE(c));
+            assert(dp == up); // !!! not all case changes same byte size?
+        }
+        bp = cast(REBYTE*, up);
+        --len;
     }
 }
 
@@ -0,0 +1,768 @@
+//
+//  File: %s-serial.c
+//  Summary: "compact binary serialization of values (SAVE/BINARY)"
+//  Section: strings
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Persisting data as MOLD text means LOAD has to run the whole scanner over
+// it again: finding delimiters, parsing numbers (decimals via %f-dtoa.c),
+// decoding escapes and interning every word one occurrence at a time.  This
+// is a binary format that SAVE/BINARY writes and LOAD/BINARY reads instead,
+// where values are length-prefixed and payloads are stored directly:
+//
+//     magic:    "RBIN" and a version byte
+//     symbols:  byte offset of the symbol table (8 bytes, little endian)
+//     values:   count of the values, then each value
+//     table:    count of the symbols, then each one's UTF-8 size and bytes
+//
+// Each distinct word spelling is interned only once per load, through the
+// symbol table.  The table comes last so the values can be written in one
+// pass, with its offset patched into the header at the end.
+//
+// Counts, sizes and integers are "varints", 7 bits per byte low bits first
+// with the high bit set on all but the last byte.  INTEGER! is zigzag coded
+// so that small negative numbers stay small.
+//
+// A value is a tag byte (with SERIAL_NEWLINE or'd in if the value had a
+// newline marker before it in its array) and then its payload.  Types with
+// no direct encoding are stored as their MOLD/ALL text, and go through the
+// scanner when they are loaded.
+//
+// Notes:
+//
+// * The tags are fixed by this file, not taken from the Reb_Kind numbering,
+//   so saved data doesn't change meaning if the datatype table is reordered.
+//
+// * Series are saved from their index, as MOLD does (without /ALL).
+//
+// * Strings and binaries are copied out of the loaded data.  Series always
+//   own their content, so there's no way for a TEXT! or BINARY! to alias a
+//   span of some other buffer.  But the copy is a single memcpy() into a
+//   series of the exact size, after a validation pass for UTF-8.
+//
+
+#include "sys-core.h"
+
+
+#define SERIAL_VERSION 1
+#define SERIAL_HEADER_SIZE (4 + 1 + 8)  // magic, version, symbol table offset
+
+#define SERIAL_NEWLINE 0x80  // or'd into the tag byte
+
+enum Reb_Serial_Tag {
+    SERIAL_TAG_MOLDED,  // UTF-8 size and MOLD/ALL text, for other types
+    SERIAL_TAG_QUOTED,  // quote depth, then the tag and payload of the value
+    SERIAL_TAG_BLANK,
+    SERIAL_TAG_FALSE,
+    SERIAL_TAG_TRUE,
+    SERIAL_TAG_INTEGER,  // zigzag varint
+    SERIAL_TAG_DECIMAL,  // IEEE 754 bits (8 bytes, little endian)
+    SERIAL_TAG_PERCENT,
+    SERIAL_TAG_CHAR,  // codepoint
+
+    SERIAL_TAG_BINARY,  // size and bytes
+
+    SERIAL_TAG_TEXT,  // all strings are UTF-8 size and bytes
+    SERIAL_TAG_FILE,
+    SERIAL_TAG_EMAIL,
+    SERIAL_TAG_URL,
+    SERIAL_TAG_TAG,
+    SERIAL_TAG_ISSUE,
+
+    SERIAL_TAG_WORD,  // all words are an index into the symbol table
+    SERIAL_TAG_SET_WORD,
+    SERIAL_TAG_GET_WORD,
+    SERIAL_TAG_SYM_WORD,
+
+    SERIAL_TAG_BLOCK,  // all arrays are (count << 1 | newline at tail)...
+    SERIAL_TAG_SET_BLOCK,  // ...and then that many values
+    SERIAL_TAG_GET_BLOCK,
+    SERIAL_TAG_SYM_BLOCK,
+    SERIAL_TAG_GROUP,
+    SERIAL_TAG_SET_GROUP,
+    SERIAL_TAG_GET_GROUP,
+    SERIAL_TAG_SYM_GROUP,
+
+    SERIAL_TAG_MAX
+};
+
+static const REBYTE Serial_Magic[4] = {'R', 'B', 'I', 'N'};
+
+// Most a varint takes up, for a 64-bit number
+//
+#define MAX_VARINT_SIZE 10
+
+
+//=//// WRITING ///////////////////////////////////////////////////////////=//
+
+struct Reb_Serializer {
+    REBSER *out;  // BINARY! being built
+    struct Reb_Binder binder;  // canon => 1-based index into `symbols`
+    REBSER *symbols;  // REBSTR* spellings, in symbol table order
+};
+
+
+// Get a pointer to write at least `n` more bytes to at the output's tail.
+// How much was actually written is then given to Serial_Commit().
+//
+static REBYTE *Serial_Reserve(REBSER *out, REBLEN n)
+{
+    if (SER_REST(out) - SER_USED(out) <= n)  // keep room for terminator
+        Extend_Series(out, n);
+    return BIN_TAIL(out);
+}
+
+static void Serial_Commit(REBSER *out, REBYTE *bp)
+  { SET_SERIES_LEN(out, bp - BIN_HEAD(out)); }
+
+static REBYTE *Write_Varint(REBYTE *bp, REBU64 u)
+{
+    while (u >= 0x80) {
+        *bp++ = cast(REBYTE, u) | 0x80;
+        u >>= 7;
+    }
+    *bp++ = cast(REBYTE, u);
+    return bp;
+}
+
+static void Serialize_Bytes(
+    REBSER *out,
+    REBYTE tag,
+    const REBYTE *data,
+    REBSIZ size
+){
+    REBYTE *bp = Serial_Reserve(out, 1 + MAX_VARINT_SIZE + size);
+    *bp++ = tag;
+    bp = Write_Varint(bp, size);
+    memcpy(bp, data, size);
+    Serial_Commit(out, bp + size);
+}
+
+
+static void Serialize_Array(
+    struct Reb_Serializer *ser,
+    const RELVAL *head,
+    REBLEN len,
+    bool newline_at_tail
+);
+
+
+//
+//  Serialize_Value: C
+//
+static void Serialize_Value(struct Reb_Serializer *ser, const RELVAL *v)
+{
+    if (C_STACK_OVERFLOWING(&ser))
+        Fail_Stack_Overflow();
+
+    REBSER *out = ser->out;
+    REBYTE newline = GET_CELL_FLAG(v, NEWLINE_BEFORE) ? SERIAL_NEWLINE : 0;
+
+    const REBCEL *cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    REBYTE tag;
+    switch (kind) {
+      case REB_BLANK: tag = SERIAL_TAG_BLANK; break;
+      case REB_LOGIC:
+        tag = VAL_LOGIC(cell) ? SERIAL_TAG_TRUE : SERIAL_TAG_FALSE;
+        break;
+      case REB_INTEGER: tag = SERIAL_TAG_INTEGER; break;
+      case REB_DECIMAL: tag = SERIAL_TAG_DECIMAL; break;
+      case REB_PERCENT: tag = SERIAL_TAG_PERCENT; break;
+      case REB_CHAR: tag = SERIAL_TAG_CHAR; break;
+      case REB_BINARY: tag = SERIAL_TAG_BINARY; break;
+      case REB_TEXT: tag = SERIAL_TAG_TEXT; break;
+      case REB_FILE: tag = SERIAL_TAG_FILE; break;
+      case REB_EMAIL: tag = SERIAL_TAG_EMAIL; break;
+      case REB_URL: tag = SERIAL_TAG_URL; break;
+      case REB_TAG: tag = SERIAL_TAG_TAG; break;
+      case REB_ISSUE: tag = SERIAL_TAG_ISSUE; break;
+      case REB_WORD: tag = SERIAL_TAG_WORD; break;
+      case REB_SET_WORD: tag = SERIAL_TAG_SET_WORD; break;
+      case REB_GET_WORD: tag = SERIAL_TAG_GET_WORD; break;
+      case REB_SYM_WORD: tag = SERIAL_TAG_SYM_WORD; break;
+      case REB_BLOCK: tag = SERIAL_TAG_BLOCK; break;
+      case REB_SET_BLOCK: tag = SERIAL_TAG_SET_BLOCK; break;
+      case REB_GET_BLOCK: tag = SERIAL_TAG_GET_BLOCK; break;
+      case REB_SYM_BLOCK: tag = SERIAL_TAG_SYM_BLOCK; break;
+      case REB_GROUP: tag = SERIAL_TAG_GROUP; break;
+      case REB_SET_GROUP: tag = SERIAL_TAG_SET_GROUP; break;
+      case REB_GET_GROUP: tag = SERIAL_TAG_GET_GROUP; break;
+      case REB_SYM_GROUP: tag = SERIAL_TAG_SYM_GROUP; break;
+      default: tag = SERIAL_TAG_MOLDED; break;
+    }
+
+    // Arrays that contain themselves can't be written out as nested arrays.
+    // Fall back on the MOLD, which will write them with `...` like PROBE.
+    //
+    if (
+        ANY_ARRAY_KIND(kind)
+        and Find_Pointer_In_Series(TG_Mold_Stack, VAL_ARRAY(cell)) != NOT_FOUND
+    ){
+        tag = SERIAL_TAG_MOLDED;
+    }
+
+    if (tag == SERIAL_TAG_MOLDED) {  // quotes are part of the molded text
+        DECLARE_MOLD (mo);
+        SET_MOLD_FLAG(mo, MOLD_FLAG_ALL);
+        Push_Mold(mo);
+        Mold_Value(mo, v);
+        Serialize_Bytes(
+            out,
+            SERIAL_TAG_MOLDED | newline,
+            BIN_AT(SER(mo->series), mo->offset),
+            STR_SIZE(mo->series) - mo->offset
+        );
+        Drop_Mold(mo);
+        return;
+    }
+
+    REBYTE *bp = Serial_Reserve(out, 2 * (1 + MAX_VARINT_SIZE));
+
+    REBLEN depth = VAL_NUM_QUOTES(v);
+    if (depth != 0) {
+        *bp++ = SERIAL_TAG_QUOTED | newline;
+        bp = Write_Varint(bp, depth);
+        newline = 0;
+    }
+
+    switch (tag) {
+      case SERIAL_TAG_BLANK:
+      case SERIAL_TAG_FALSE:
+      case SERIAL_TAG_TRUE:
+        *bp++ = tag | newline;
+        Serial_Commit(out, bp);
+        break;
+
+      case SERIAL_TAG_INTEGER: {
+        REBI64 i = VAL_INT64(cell);
+        *bp++ = tag | newline;
+        bp = Write_Varint(
+            bp,
+            (cast(REBU64, i) << 1) ^ cast(REBU64, i >> 63)  // zigzag
+        );
+        Serial_Commit(out, bp);
+        break; }
+
+      case SERIAL_TAG_DECIMAL:
+      case SERIAL_TAG_PERCENT: {
+        REBDEC d = VAL_DECIMAL(cell);
+        REBU64 bits;
+        memcpy(&bits, &d, sizeof(bits));
+        *bp++ = tag | newline;
+        REBLEN n;
+        for (n = 0; n < 8; ++n, bits >>= 8)
+            *bp++ = cast(REBYTE, bits);
+        Serial_Commit(out, bp);
+        break; }
+
+      case SERIAL_TAG_CHAR:
+        *bp++ = tag | newline;
+        bp = Write_Varint(bp, VAL_CHAR(cell));
+        Serial_Commit(out, bp);
+        break;
+
+      case SERIAL_TAG_BINARY:
+        Serial_Commit(out, bp);
+        Serialize_Bytes(
+            out, tag | newline, VAL_BIN_AT(cell), VAL_LEN_AT(cell)
+        );
+        break;
+
+      case SERIAL_TAG_TEXT:
+      case SERIAL_TAG_FILE:
+      case SERIAL_TAG_EMAIL:
+      case SERIAL_TAG_URL:
+      case SERIAL_TAG_TAG:
+      case SERIAL_TAG_ISSUE: {
+        Serial_Commit(out, bp);
+        REBSIZ size = VAL_SIZE_LIMIT_AT(nullptr, cell, -1);
+        Serialize_Bytes(
+            out,
+            tag | newline,
+            cast(const REBYTE*, VAL_STRING_AT(cell)),
+            size
+        );
+        break; }
+
+      case SERIAL_TAG_WORD:
+      case SERIAL_TAG_SET_WORD:
+      case SERIAL_TAG_GET_WORD:
+      case SERIAL_TAG_SYM_WORD: {
+        //
+        // The binder is keyed by canon, so a spelling differing only in
+        // case from the first one seen gets an entry of its own (which is
+        // not remembered, so it's repeated per occurrence--that's rare).
+        //
+        REBSTR *spelling = VAL_WORD_SPELLING(cell);
+        REBSTR *canon = VAL_WORD_CANON(cell);
+        REBINT index = Get_Binder_Index_Else_0(&ser->binder, canon);
+        if (
+            index == 0
+            or *SER_AT(REBSTR*, ser->symbols, index - 1) != spelling
+        ){
+            if (index == 0)
+                Add_Binder_Index(
+                    &ser->binder, canon, SER_LEN(ser->symbols) + 1
+                );
+            index = SER_LEN(ser->symbols) + 1;
+            Push_Pointer_To_Series(ser->symbols, spelling);
+        }
+        *bp++ = tag | newline;
+        bp = Write_Varint(bp, index - 1);
+        Serial_Commit(out, bp);
+        break; }
+
+      default: {
+        assert(ANY_ARRAY_KIND(kind));
+        *bp++ = tag | newline;
+        Serial_Commit(out, bp);
+
+        REBARR *a = VAL_ARRAY(cell);
+        Push_Pointer_To_Series(TG_Mold_Stack, a);
+        Serialize_Array(
+            ser,
+            VAL_ARRAY_AT(cell),
+            VAL_LEN_AT(cell),
+            GET_ARRAY_FLAG(a, NEWLINE_AT_TAIL)
+        );
+        Drop_Pointer_From_Series(TG_Mold_Stack, a);
+        break; }
+    }
+}
+
+
+//
+//  Serialize_Array: C
+//
+static void Serialize_Array(
+    struct Reb_Serializer *ser,
+    const RELVAL *head,
+    REBLEN len,
+    bool newline_at_tail
+){
+    REBYTE *bp = Serial_Reserve(ser->out, MAX_VARINT_SIZE);
+    bp = Write_Varint(
+        bp,
+        (cast(REBU64, len) << 1) | (newline_at_tail ? 1 : 0)
+    );
+    Serial_Commit(ser->out, bp);
+
+    const RELVAL *item = head;
+    for (; len != 0; --len, ++item)
+        Serialize_Value(ser, item);
+}
+
+
+//
+//  serialize: native [
+//
+//  {Encode values in the compact binary format of SAVE/BINARY}
+//
+//      return: [binary!]
+//      value "A BLOCK!'s values are saved on their own, as with MOLD/ONLY"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(serialize)
+{
+    INCLUDE_PARAMS_OF_SERIALIZE;
+
+    REBVAL *v = ARG(value);
+
+    struct Reb_Serializer ser;
+    ser.out = Make_Binary(SERIAL_HEADER_SIZE + 64);
+    ser.symbols = Make_Series(64, sizeof(REBSTR*));
+    INIT_BINDER(&ser.binder);
+
+    REBYTE *bp = BIN_HEAD(ser.out);
+    memcpy(bp, Serial_Magic, 4);
+    bp[4] = SERIAL_VERSION;
+    Serial_Commit(ser.out, bp + SERIAL_HEADER_SIZE);  // offset patched below
+
+    if (IS_BLOCK(v))
+        Serialize_Array(
+            &ser,
+            VAL_ARRAY_AT(v),
+            VAL_LEN_AT(v),
+            GET_ARRAY_FLAG(VAL_ARRAY(v), NEWLINE_AT_TAIL)
+        );
+    else {
+        bp = Serial_Reserve(ser.out, 1);
+        *bp++ = 1 << 1;  // a count of one value, no newline at tail
+        Serial_Commit(ser.out, bp);
+        Serialize_Value(&ser, v);
+    }
+
+    REBU64 offset = BIN_LEN(ser.out);
+    bp = BIN_AT(ser.out, 5);
+    REBLEN n;
+    for (n = 0; n < 8; ++n, offset >>= 8)
+        bp[n] = cast(REBYTE, offset);
+
+    REBLEN num_symbols = SER_LEN(ser.symbols);
+    bp = Serial_Reserve(ser.out, MAX_VARINT_SIZE);
+    Serial_Commit(ser.out, Write_Varint(bp, num_symbols));
+
+    REBLEN i;
+    for (i = 0; i < num_symbols; ++i) {
+        REBSTR *spelling = *SER_AT(REBSTR*, ser.symbols, i);
+        REBSIZ size = STR_SIZE(spelling);
+
+        bp = Serial_Reserve(ser.out, MAX_VARINT_SIZE + size);
+        bp = Write_Varint(bp, size);
+        memcpy(bp, STR_UTF8(spelling), size);
+        Serial_Commit(ser.out, bp + size);
+
+        Remove_Binder_Index_Else_0(&ser.binder, STR_CANON(spelling));
+    }
+
+    SHUTDOWN_BINDER(&ser.binder);
+    Free_Unmanaged_Series(ser.symbols);
+
+    TERM_BIN_LEN(ser.out, BIN_LEN(ser.out));
+    return Init_Binary(D_OUT, ser.out);
+}
+
+
+//=//// READING ///////////////////////////////////////////////////////////=//
+
+struct Reb_Deserializer {
+    const REBYTE *bp;
+    const REBYTE *end;
+    REBSER *symbols;  // interned REBSTR* for each symbol table entry
+};
+
+
+static REBCTX *Error_Bad_Serial(const char *problem)
+{
+    DECLARE_LOCAL (arg);
+    Init_Text(arg, Make_String_UTF8(problem));
+    return Error_Bad_Serial_Raw(arg);
+}
+
+static REBU64 Read_Varint(struct Reb_Deserializer *des)
+{
+    REBU64 u = 0;
+    REBLEN shift = 0;
+    for (; shift < 64; shift += 7) {
+        if (des->bp == des->end)
+            fail (Error_Bad_Serial("truncated"));
+
+        REBYTE b = *des->bp++;
+        u |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return u;
+    }
+    fail (Error_Bad_Serial("number too large"));
+}
+
+static const REBYTE *Read_Bytes(struct Reb_Deserializer *des, REBU64 size)
+{
+    if (size > cast(REBU64, des->end - des->bp))
+        fail (Error_Bad_Serial("truncated"));
+
+    const REBYTE *bp = des->bp;
+    des->bp += size;
+    return bp;
+}
+
+
+// Count the codepoints in UTF-8 from the serialized data, failing if it isn't
+// valid (it's going to be used directly as string content).
+//
+static REBLEN Count_Utf8_May_Fail(const REBYTE *bp, REBSIZ size)
+{
+    const REBYTE *end = bp + size;
+    REBLEN len = 0;
+    while (true) {
+        REBSIZ ascii = Ascii_Run_Size(bp, end);
+        bp += ascii;
+        len += ascii;
+        if (bp == end)
+            return len;
+
+        REBUNI c;
+        REBSIZ left = end - bp;
+        bp = Back_Scan_UTF8_Char(&c, bp, &left);
+        if (bp == nullptr)
+            fail (Error_Bad_Utf8_Raw());
+        ++bp;
+        ++len;
+    }
+}
+
+
+static void Deserialize_Array_Push(
+    struct Reb_Deserializer *des,
+    enum Reb_Kind kind
+);
+
+
+//
+//  Deserialize_Push: C
+//
+// Decode the value at the read position onto the data stack.  Values can't
+// be decoded into a cell given by the caller, because decoding arrays pushes
+// their items...which could move the data stack.
+//
+static void Deserialize_Push(struct Reb_Deserializer *des)
+{
+    if (C_STACK_OVERFLOWING(&des))
+        Fail_Stack_Overflow();
+
+    const REBYTE *bp = Read_Bytes(des, 1);
+    bool newline = did (*bp & SERIAL_NEWLINE);
+    REBYTE tag = *bp & ~SERIAL_NEWLINE;
+
+    REBLEN depth = 0;
+    if (tag == SERIAL_TAG_QUOTED) {
+        REBU64 u = Read_Varint(des);
+        if (u == 0 or u > UINT32_MAX)
+            fail (Error_Bad_Serial("bad quote level"));
+        depth = cast(REBLEN, u);
+        tag = *Read_Bytes(des, 1);
+    }
+
+    switch (tag) {
+      case SERIAL_TAG_MOLDED: {
+        REBU64 size = Read_Varint(des);
+        bp = Read_Bytes(des, size);
+        Count_Utf8_May_Fail(bp, size);
+
+        REBARR *a = Scan_UTF8_Managed(Canon(SYM___ANONYMOUS__), bp, size);
+        if (ARR_LEN(a) != 1)
+            fail (Error_Bad_Serial("molded value is not a single value"));
+        Derelativize(DS_PUSH(), ARR_HEAD(a), SPECIFIED);
+        CLEAR_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        break; }
+
+      case SERIAL_TAG_BLANK:
+        Init_Blank(DS_PUSH());
+        break;
+
+      case SERIAL_TAG_FALSE:
+      case SERIAL_TAG_TRUE:
+        Init_Logic(DS_PUSH(), tag == SERIAL_TAG_TRUE);
+        break;
+
+      case SERIAL_TAG_INTEGER: {
+        REBU64 u = Read_Varint(des);
+        Init_Integer(DS_PUSH(), cast(REBI64, (u >> 1) ^ (0 - (u & 1))));
+        break; }
+
+      case SERIAL_TAG_DECIMAL:
+      case SERIAL_TAG_PERCENT: {
+        bp = Read_Bytes(des, 8);
+        REBU64 bits = 0;
+        REBLEN n;
+        for (n = 8; n != 0; --n)
+            bits = (bits << 8) | bp[n - 1];
+        REBDEC d;
+        memcpy(&d, &bits, sizeof(d));
+        if (tag == SERIAL_TAG_DECIMAL)
+            Init_Decimal(DS_PUSH(), d);
+        else
+            Init_Percent(DS_PUSH(), d);
+        break; }
+
+      case SERIAL_TAG_CHAR: {
+        REBU64 u = Read_Varint(des);
+        if (u > UNI_MAX_LEGAL_UTF32)
+            fail (Error_Bad_Serial("bad codepoint"));
+        Init_Char_May_Fail(DS_PUSH(), cast(REBUNI, u));
+        break; }
+
+      case SERIAL_TAG_BINARY: {
+        REBU64 size = Read_Varint(des);
+        bp = Read_Bytes(des, size);
+        REBSER *bin = Make_Binary(size);
+        memcpy(BIN_HEAD(bin), bp, size);
+        TERM_BIN_LEN(bin, size);
+        Init_Binary(DS_PUSH(), bin);
+        break; }
+
+      case SERIAL_TAG_TEXT:
+      case SERIAL_TAG_FILE:
+      case SERIAL_TAG_EMAIL:
+      case SERIAL_TAG_URL:
+      case SERIAL_TAG_TAG:
+      case SERIAL_TAG_ISSUE: {
+        REBU64 size = Read_Varint(des);
+        bp = Read_Bytes(des, size);
+        REBLEN len = Count_Utf8_May_Fail(bp, size);
+
+        REBSTR *s = Make_String(size);
+        memcpy(BIN_HEAD(SER(s)), bp, size);
+        TERM_STR_LEN_SIZE(s, len, size);
+
+        enum Reb_Kind kind;
+        switch (tag) {
+          case SERIAL_TAG_TEXT: kind = REB_TEXT; break;
+          case SERIAL_TAG_FILE: kind = REB_FILE; break;
+          case SERIAL_TAG_EMAIL: kind = REB_EMAIL; break;
+          case SERIAL_TAG_URL: kind = REB_URL; break;
+          case SERIAL_TAG_TAG: kind = REB_TAG; break;
+          default: kind = REB_ISSUE; break;
+        }
+        Init_Any_String(DS_PUSH(), kind, s);
+        break; }
+
+      case SERIAL_TAG_WORD:
+      case SERIAL_TAG_SET_WORD:
+      case SERIAL_TAG_GET_WORD:
+      case SERIAL_TAG_SYM_WORD: {
+        REBU64 index = Read_Varint(des);
+        if (index >= SER_LEN(des->symbols))
+            fail (Error_Bad_Serial("bad symbol index"));
+
+        enum Reb_Kind kind;
+        switch (tag) {
+          case SERIAL_TAG_WORD: kind = REB_WORD; break;
+          case SERIAL_TAG_SET_WORD: kind = REB_SET_WORD; break;
+          case SERIAL_TAG_GET_WORD: kind = REB_GET_WORD; break;
+          default: kind = REB_SYM_WORD; break;
+        }
+        Init_Any_Word(
+            DS_PUSH(), kind, *SER_AT(REBSTR*, des->symbols, index)
+        );
+        break; }
+
+      case SERIAL_TAG_BLOCK: Deserialize_Array_Push(des, REB_BLOCK); break;
+      case SERIAL_TAG_SET_BLOCK:
+        Deserialize_Array_Push(des, REB_SET_BLOCK);
+        break;
+      case SERIAL_TAG_GET_BLOCK:
+        Deserialize_Array_Push(des, REB_GET_BLOCK);
+        break;
+      case SERIAL_TAG_SYM_BLOCK:
+        Deserialize_Array_Push(des, REB_SYM_BLOCK);
+        break;
+      case SERIAL_TAG_GROUP: Deserialize_Array_Push(des, REB_GROUP); break;
+      case SERIAL_TAG_SET_GROUP:
+        Deserialize_Array_Push(des, REB_SET_GROUP);
+        break;
+      case SERIAL_TAG_GET_GROUP:
+        Deserialize_Array_Push(des, REB_GET_GROUP);
+        break;
+      case SERIAL_TAG_SYM_GROUP:
+        Deserialize_Array_Push(des, REB_SYM_GROUP);
+        break;
+
+      default:
+        fail (Error_Bad_Serial("unknown tag"));
+    }
+
+    if (depth != 0)
+        Quotify(DS_TOP, depth);
+    if (newline)
+        SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+}
+
+
+//
+//  Deserialize_Array_Push: C
+//
+static void Deserialize_Array_Push(
+    struct Reb_Deserializer *des,
+    enum Reb_Kind kind
+){
+    REBU64 u = Read_Varint(des);
+    REBU64 len = u >> 1;
+    if (len > cast(REBU64, des->end - des->bp))  // every value is >= 1 byte
+        fail (Error_Bad_Serial("truncated"));
+
+    REBDSP dsp_orig = DSP;
+    for (; len != 0; --len)
+        Deserialize_Push(des);
+
+    REBARR *a = Pop_Stack_Values_Core(
+        dsp_orig,
+        NODE_FLAG_MANAGED | ((u & 1) ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
+    );
+    Init_Any_Array(DS_PUSH(), kind, a);
+}
+
+
+//
+//  deserialize: native [
+//
+//  {Decode the compact binary format of SAVE/BINARY into a block of values}
+//
+//      return: [block!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(deserialize)
+{
+    INCLUDE_PARAMS_OF_DESERIALIZE;
+
+    const REBYTE *head = VAL_BIN_AT(ARG(data));
+    REBSIZ size = VAL_LEN_AT(ARG(data));
+
+    if (size < SERIAL_HEADER_SIZE or memcmp(head, Serial_Magic, 4) != 0)
+        fail (Error_Bad_Serial("not SAVE/BINARY data"));
+    if (head[4] != SERIAL_VERSION)
+        fail (Error_Bad_Serial("unsupported version"));
+
+    REBU64 offset = 0;
+    REBLEN n;
+    for (n = 8; n != 0; --n)
+        offset = (offset << 8) | head[4 + n];
+    if (offset < SERIAL_HEADER_SIZE or offset > size)
+        fail (Error_Bad_Serial("bad symbol table offset"));
+
+    struct Reb_Deserializer des;
+    des.bp = head + offset;
+    des.end = head + size;
+
+    REBU64 num_symbols = Read_Varint(&des);
+    if (num_symbols > cast(REBU64, des.end - des.bp))
+        fail (Error_Bad_Serial("truncated"));
+
+    des.symbols = Make_Series(num_symbols + 1, sizeof(REBSTR*));
+    for (; num_symbols != 0; --num_symbols) {
+        REBU64 spelling_size = Read_Varint(&des);
+        const REBYTE *utf8 = Read_Bytes(&des, spelling_size);
+        if (spelling_size == 0)
+            fail (Error_Bad_Serial("empty symbol"));
+        Count_Utf8_May_Fail(utf8, spelling_size);
+        Push_Pointer_To_Series(
+            des.symbols,
+            Intern_UTF8_Managed(utf8, spelling_size)
+        );
+    }
+    if (des.bp != des.end)
+        fail (Error_Bad_Serial("extra data after symbol table"));
+
+    des.bp = head + SERIAL_HEADER_SIZE;
+    des.end = head + offset;
+
+    REBDSP dsp_orig = DSP;
+    Deserialize_Array_Push(&des, REB_BLOCK);
+    if (des.bp != des.end)
+        fail (Error_Bad_Serial("extra data after values"));
+
+    Move_Value(D_OUT, DS_TOP);
+    DS_DROP_TO(dsp_orig);
+
+    Free_Unmanaged_Series(des.symbols);
+    return D_OUT;
+}
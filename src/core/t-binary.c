@@ -760,6 +760,13 @@ REBTYPE(Binary)
 
         REBINT len = Part_Len_May_Modify_Index(v, ARG(part));
 
+        if (REF(share))
+            return Init_Any_Series(
+                D_OUT,
+                REB_BINARY,
+                Copy_Sequence_Shared_Managed(VAL_SERIES(v), VAL_INDEX(v), len)
+            );
+
         return Init_Any_Series(
             D_OUT,
             REB_BINARY,
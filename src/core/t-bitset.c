@@ -239,6 +239,224 @@ retry:
 }
 
 
+//
+//  Init_Byte_Bits: C
+//
+// Copy the bits for byte values 0-255 out of a bitset, applying negation and
+// (if `uncased`) ASCII case folding.  This doesn't call Check_Bit() for each
+// value, as the uppercase ASCII letters are 32 codepoints (4 bytes of bits)
+// away from the lowercase ones at the same bit positions--so folding is just
+// OR'ing those two ranges together under a mask of the letter positions.
+//
+void Init_Byte_Bits(struct Reb_Byte_Bits *bb, REBSER *bset, bool uncased)
+{
+    REBLEN tail = SER_LEN(bset);
+    REBLEN n = MIN(tail, sizeof(bb->bits));
+    memcpy(bb->bits, BIN_HEAD(bset), n);
+    CLEAR(bb->bits + n, sizeof(bb->bits) - n);
+
+    if (uncased) {
+        static const REBYTE letters[4] = {  // bits for 'A'-'Z' and 'a'-'z'
+            0x7F, 0xFF, 0xFF, 0xE0
+        };
+
+        REBLEN i;
+        for (i = 0; i < 4; ++i) {
+            REBYTE either = (bb->bits[8 + i] | bb->bits[12 + i]) & letters[i];
+            bb->bits[8 + i] |= either;
+            bb->bits[12 + i] |= either;
+        }
+    }
+    bb->folded = uncased;
+
+    if (BITS_NOT(bset)) {
+        REBLEN i;
+        for (i = 0; i < sizeof(bb->bits); ++i)
+            bb->bits[i] = ~bb->bits[i];
+    }
+}
+
+
+#ifdef CPU_X86_DISPATCH
+    //
+    // The SSSE3 span looks bytes up 16 at a time with PSHUFB, which indexes
+    // a 16-byte table by the low nibble of each byte.  So the bits are laid
+    // out as a row per low nibble, with a bit for each high nibble: one table
+    // for bytes below 0x80 and another for the rest.
+    //
+    static void Init_Byte_Rows(REBYTE rows[32], const struct Reb_Byte_Bits *bb)
+    {
+        memset(rows, 0, 32);
+
+        REBLEN i;
+        for (i = 0; i < sizeof(bb->bits); ++i) {
+            REBYTE byte = bb->bits[i];
+            REBLEN b = i << 3;
+            for (; byte != 0; byte <<= 1, ++b) {
+                if (byte & 0x80)
+                    rows[((b >> 7) << 4) | (b & 0xF)] |= 1 << ((b >> 4) & 7);
+            }
+        }
+    }
+
+    // Count how many of the first `len` bytes are (or aren't) in the rows, a
+    // whole 16 at a time, stopping short of the 16 with the first mismatch
+    // (or non-ASCII byte, if `ascii_only`) for the caller to deal with.
+    //
+    CPU_TARGET("ssse3")
+    static REBLEN Span_Byte_Rows_Ssse3(
+        const REBYTE rows[32],
+        const REBYTE *bp,
+        REBLEN len,
+        bool want,
+        bool ascii_only
+    ){
+        __m128i lo_rows = _mm_loadu_si128(cast(const __m128i*, rows));
+        __m128i hi_rows = _mm_loadu_si128(cast(const __m128i*, rows + 16));
+        __m128i lo_bits = _mm_setr_epi8(
+            1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0
+        );
+        __m128i hi_bits = _mm_setr_epi8(
+            0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128
+        );
+        __m128i nibble = _mm_set1_epi8(0x0F);
+
+        REBLEN n;
+        for (n = 0; n + 16 <= len; n += 16) {
+            __m128i x = _mm_loadu_si128(cast(const __m128i*, bp + n));
+            __m128i lo = _mm_and_si128(x, nibble);
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+            __m128i in = _mm_or_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8(lo_rows, lo),
+                    _mm_shuffle_epi8(lo_bits, hi)
+                ),
+                _mm_and_si128(
+                    _mm_shuffle_epi8(hi_rows, lo),
+                    _mm_shuffle_epi8(hi_bits, hi)
+                )
+            );
+            unsigned out = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(in, _mm_setzero_si128())
+            );
+            unsigned stop = want ? out : (~out & 0xFFFF);
+            if (ascii_only)
+                stop |= _mm_movemask_epi8(x);
+
+            if (stop != 0) {
+                for (; not (stop & 1); stop >>= 1)
+                    ++n;
+                return n;
+            }
+        }
+        return n;
+    }
+#endif
+
+
+//
+//  Span_Bitset_Bytes: C
+//
+// Count how many bytes from the start of `bp` are in the bitset (if `want`
+// is true) or aren't (if `want` is false), so that PARSE can skip a whole run
+// of `some charset` matches at once and FIND can skip to the first match.
+//
+REBLEN Span_Bitset_Bytes(
+    const REBYTE *bp,
+    REBLEN len,
+    REBSER *bset,
+    bool uncased,
+    bool want
+){
+    struct Reb_Byte_Bits bb;
+    Init_Byte_Bits(&bb, bset, uncased);
+
+  #ifdef CPU_X86_DISPATCH
+    REBYTE rows[32];
+    bool simd = (len >= 64 and Cpu_Has(CPU_SSSE3));  // else rows cost more
+    if (simd)
+        Init_Byte_Rows(rows, &bb);
+  #endif
+
+    REBLEN n = 0;
+    while (n < len) {
+      #ifdef CPU_X86_DISPATCH
+        if (simd) {
+            n += Span_Byte_Rows_Ssse3(rows, bp + n, len - n, want, uncased);
+            if (n == len)
+                break;
+        }
+      #endif
+
+        REBYTE b = bp[n];
+        bool in;
+        if (b < 0x80 or not uncased)
+            in = Check_Byte_Bit(&bb, b);
+        else
+            in = Check_Bit(bset, b, true);
+        if (in != want)
+            break;
+        ++n;
+    }
+    return n;
+}
+
+
+//
+//  Span_Bitset_Utf8: C
+//
+// Span_Bitset_Bytes() for UTF-8 string data, counting up to `limit` whole
+// codepoints (not bytes).  ASCII bytes are checked against the copied bits,
+// and the rare non-ASCII codepoint is decoded and given to Check_Bit().
+//
+REBLEN Span_Bitset_Utf8(
+    const REBYTE *bp,
+    REBLEN limit,
+    REBSER *bset,
+    bool uncased,
+    bool want
+){
+    struct Reb_Byte_Bits bb;
+    Init_Byte_Bits(&bb, bset, uncased);
+
+  #ifdef CPU_X86_DISPATCH
+    REBYTE rows[32];
+    bool simd = (limit >= 64 and Cpu_Has(CPU_SSSE3));
+    if (simd)
+        Init_Byte_Rows(rows, &bb);
+  #endif
+
+    REBLEN n = 0;
+    while (n < limit) {
+      #ifdef CPU_X86_DISPATCH
+        if (simd) {  // ASCII only, so bytes are codepoints (and there are
+            const bool ascii_only = true;  // at least `limit - n` of them)
+            REBLEN ascii = Span_Byte_Rows_Ssse3(
+                rows, bp, limit - n, want, ascii_only
+            );
+            bp += ascii;
+            n += ascii;
+            if (n == limit)
+                break;
+        }
+      #endif
+
+        bool in;
+        if (*bp < 0x80)
+            in = Check_Byte_Bit(&bb, *bp++);
+        else {
+            REBUNI c;
+            bp = Back_Scan_UTF8_Char(&c, bp, NULL) + 1;
+            in = Check_Bit(bset, c, uncased);
+        }
+        if (in != want)
+            break;
+        ++n;
+    }
+    return n;
+}
+
+
 //
 //  Set_Bit: C
 //
@@ -424,25 +642,19 @@ bool Check_Bits(REBSER *bset, const REBVAL *val, bool uncased)
         return Check_Bit(bset, Int32s(val, 0), uncased);
 
     if (IS_BINARY(val)) {
-        REBLEN i = VAL_INDEX(val);
-        REBYTE *bp = VAL_BIN_HEAD(val);
-        for (; i != VAL_LEN_HEAD(val); ++i)
-            if (Check_Bit(bset, bp[i], uncased))
-                return true;
-        return false;
+        REBLEN len = VAL_LEN_AT(val);
+        const bool want = false;  // count bytes *not* in the set
+        return len != Span_Bitset_Bytes(
+            VAL_BIN_AT(val), len, bset, uncased, want
+        );
     }
 
     if (ANY_STRING(val)) {
-        REBLEN i = VAL_INDEX(val);
-        REBCHR(const*) up = VAL_STRING_AT(val);
-        for (; i != VAL_LEN_HEAD(val); ++i) {
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (Check_Bit(bset, c, uncased))
-                return true;
-        }
-
-        return false;
+        REBLEN len = VAL_LEN_AT(val);
+        const bool want = false;  // count codepoints *not* in the set
+        return len != Span_Bitset_Utf8(
+            cast(REBYTE*, VAL_STRING_AT(val)), len, bset, uncased, want
+        );
     }
 
     if (!ANY_ARRAY(val))
@@ -651,6 +863,7 @@ REBTYPE(Bitset)
       case SYM_COPY: {
         INCLUDE_PARAMS_OF_COPY;
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // bitsets are small, and MISC() holds BITS_NOT
 
         if (REF(part) or REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
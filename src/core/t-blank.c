@@ -163,6 +163,7 @@ REBTYPE(Unit)
 
         UNUSED(REF(deep));
         UNUSED(REF(types));
+        UNUSED(REF(share));
 
         return Init_Blank(D_OUT); }
 
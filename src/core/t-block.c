@@ -1033,15 +1033,26 @@ REBTYPE(Array)
         //
         flags |= (array->header.bits & ARRAY_FLAG_CONST_SHALLOW);
 
-        REBARR *copy = Copy_Array_Core_Managed(
-            arr,
-            index, // at
-            specifier,
-            tail, // tail
-            0, // extra
-            flags, // flags
-            types // types to copy deeply
-        );
+        REBARR *copy;
+        if (REF(share))
+            copy = Copy_Array_Shared_Managed(
+                arr,
+                index, // at
+                specifier,
+                tail, // tail
+                flags, // flags
+                types // types to copy deeply
+            );
+        else
+            copy = Copy_Array_Core_Managed(
+                arr,
+                index, // at
+                specifier,
+                tail, // tail
+                0, // extra
+                flags, // flags
+                types // types to copy deeply
+            );
 
         return Init_Any_Array(D_OUT, VAL_TYPE(array), copy);
     }
@@ -1360,6 +1371,15 @@ void Assert_Array_Core(REBARR *a)
     if (NOT_END(item))
         panic (item);
 
+    // The cells of a COPY/SHARE borrower belong to its holder, and the END
+    // at its tail is the holder's terminator (see Share_Series_Data()).  It
+    // has no capacity past that cell, and the holder is checked on its own.
+    //
+    if (GET_SERIES_INFO(a, SHARED)) {
+        assert(SER_REST(SER(a)) == len + 1);
+        return;
+    }
+
     if (IS_SER_DYNAMIC(a)) {
         REBLEN rest = SER_REST(SER(a));
         assert(rest > 0 and rest > i);
@@ -171,6 +171,7 @@ REBTYPE(Action)
         INCLUDE_PARAMS_OF_COPY;
 
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // the copy is a new identity either way
 
         if (REF(part) or REF(types))
             fail (Error_Bad_Refines_Raw());
@@ -616,6 +616,8 @@ void MF_Map(REB_MOLD *mo, const REBCEL *v, bool form)
         Mold_Value(mo, key + 1);
         if (form)
             Append_Codepoint(mo->series, '\n');
+
+        Flush_Mold_If_Full(mo);
     }
     mo->indent--;
 
@@ -754,6 +756,7 @@ REBTYPE(Map)
     case SYM_COPY: {
         INCLUDE_PARAMS_OF_COPY;
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // pairlists and hashlists are always copied
 
         if (REF(part))
             fail (Error_Bad_Refines_Raw());
@@ -297,6 +297,63 @@ REB_R TO_Frame(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 }
 
 
+//
+//  Try_Init_Literal_Template_Vars: C
+//
+// A body for MAKE OBJECT! that is nothing but SET-WORD!s each followed by an
+// inert literal that needs no binding (e.g. `[name: "" age: 0 id: #]`) does
+// not need to be bound deeply and evaluated.  The values are copied into the
+// variables directly, and the SET-WORD!s bound to the object as the bind
+// would have done.  Returns false (having changed nothing) for other bodies.
+//
+static bool Try_Init_Literal_Template_Vars(REBCTX *ctx, const REBVAL *body)
+{
+    RELVAL *head = VAL_ARRAY_AT(body);
+
+    REBLEN n = 2;  // key 1 is SELF
+    RELVAL *item;
+    for (item = head; NOT_END(item); item += 2, ++n) {
+        if (KIND_BYTE(item) != REB_SET_WORD)
+            return false;
+        if (n > CTX_LEN(ctx) or VAL_WORD_CANON(item) != CTX_KEY_CANON(ctx, n))
+            return false;
+
+        if (IS_END(item + 1))
+            return false;  // `[a: 1 b:]` is an error to report by evaluation
+
+        REBYTE kind_byte = KIND_BYTE(item + 1);
+        if (kind_byte < REB_BLANK or IS_BINDABLE_KIND(kind_byte))
+            return false;  // evaluates (or is quoted), or needs binding
+    }
+    if (n != CTX_LEN(ctx) + 1)
+        return false;
+
+    REBSPC *specifier = VAL_SPECIFIER(body);
+
+    // The SET-WORD!s are bound in place, so a body borrowed by COPY/SHARE
+    // must get its own cells first (or every sharer's words would change).
+    //
+    head = VAL_ARRAY_AT_UNSHARED(body);
+
+    n = 2;
+    for (item = head; NOT_END(item); item += 2, ++n) {
+        //
+        // Evaluating the inert literal would inherit constness from the body
+        // (see Inertly_Derelativize_Inheriting_Const()), so do the same.
+        //
+        REBVAL *var = CTX_VAR(ctx, n);
+        Derelativize(var, item + 1, specifier);
+        if (NOT_CELL_FLAG(item + 1, EXPLICITLY_MUTABLE))
+            var->header.bits |= (body->header.bits & CELL_FLAG_CONST);
+
+        INIT_BINDING_MAY_MANAGE(item, NOD(ctx));
+        INIT_WORD_INDEX(item, n);
+    }
+
+    return true;
+}
+
+
 //
 //  MAKE_Context: C
 //
@@ -313,17 +370,28 @@ REB_R MAKE_Context(
     REBCTX *parent = opt_parent ? VAL_CONTEXT(opt_parent) : nullptr;
 
     if (IS_BLOCK(arg)) {
-        REBCTX *ctx = Make_Selfish_Context_Detect_Managed(
-            REB_OBJECT,
-            VAL_ARRAY_AT(arg),
-            parent
-        );
+        REBCTX *ctx;
+        if (parent)
+            ctx = Make_Selfish_Context_Detect_Managed(
+                REB_OBJECT,
+                VAL_ARRAY_AT(arg),
+                parent
+            );
+        else {
+            ctx = Make_Selfish_Context_Memoized_Managed(
+                REB_OBJECT,
+                VAL_ARRAY(arg),
+                VAL_INDEX(arg)
+            );
+            if (Try_Init_Literal_Template_Vars(ctx, arg))
+                return Init_Any_Context(out, kind, ctx);
+        }
         Init_Any_Context(out, kind, ctx); // GC guards it
 
         // !!! This binds the actual body data, not a copy of it.  See
         // Virtual_Bind_Deep_To_New_Context() for future directions.
         //
-        Bind_Values_Deep(VAL_ARRAY_AT(arg), ctx);
+        Bind_Values_Deep(VAL_ARRAY_AT_UNSHARED(arg), ctx);
 
         DECLARE_LOCAL (dummy);
         if (Do_Any_Array_At_Throws(dummy, arg, SPECIFIED)) {
@@ -650,6 +718,8 @@ void MF_Context(REB_MOLD *mo, const REBCEL *v, bool form)
                 Append_Ascii(s, "'");
             Mold_Value(mo, var);
         }
+
+        Flush_Mold_If_Full(mo);
     }
 
     mo->indent--;
@@ -814,6 +884,7 @@ REBTYPE(Context)
         INCLUDE_PARAMS_OF_COPY;
 
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // contexts are always copied
 
         if (REF(part))
             fail (Error_Bad_Refines_Raw());
@@ -895,7 +966,7 @@ REBNATIVE(construct)
             D_OUT,
             Construct_Context_Managed(
                 REB_OBJECT,
-                VAL_ARRAY_AT(spec),
+                VAL_ARRAY_AT_UNSHARED(spec),
                 VAL_SPECIFIER(spec),
                 parent
             )
@@ -916,7 +987,7 @@ REBNATIVE(construct)
     // !!! This binds the actual body data, not a copy of it.  See
     // Virtual_Bind_Deep_To_New_Context() for future directions.
     //
-    Bind_Values_Deep(VAL_ARRAY_AT(spec), context);
+    Bind_Values_Deep(VAL_ARRAY_AT_UNSHARED(spec), context);
 
     DECLARE_LOCAL (dummy);
     if (Do_Any_Array_At_Throws(dummy, spec, SPECIFIED)) {
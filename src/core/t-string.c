@@ -1207,6 +1207,7 @@ REBTYPE(String)
         INCLUDE_PARAMS_OF_COPY;
 
         UNUSED(PAR(value));
+        UNUSED(REF(share));  // bookmarks, see Copy_Sequence_Shared_Managed()
 
         if (REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
@@ -122,17 +122,263 @@ static REBCTX *Error_Compression(const z_stream *strm, int ret)
 }
 
 
+// Independent blocks are primed with the input just before them, so they
+// compress nearly as well as one stream.  (32K is the most deflate can see.)
+//
+#define DEFLATE_DICT_SIZE 32768
+
+// zlib's z_stream counts input and output in a 32-bit uInt, so a block is at
+// most this size.  Its deflateBound() still fits in a uInt, and each block
+// goes through deflate() in one call.  Larger inputs without /BLOCKS are
+// compressed in blocks of this size too, which only adds an empty stored
+// block (5 bytes) per gigabyte to the output.
+//
+#define DEFLATE_MAX_BLOCK_SIZE (cast(size_t, 1) << 30)
+
+
+// One block of a Deflate_Blocks(), compressed by Deflate_Block_Task() on
+// whichever thread Run_Tasks() gives it to.
+//
+struct Reb_Deflate_Block {
+    const REBYTE *in;
+    size_t len;
+    size_t dict_len;  // bytes of input just before `in` to prime the stream
+    bool last;
+
+    REBYTE *out;  // where the block's room in the output buffer starts
+    size_t out_len;  // the size of that room, then the size compressed
+    uLong check;  // CRC32 or ADLER32 of just this block's input
+    int ret;  // Z_OK, or the zlib error (with its message in `msg`)
+    const char *msg;
+};
+
+struct Reb_Deflate_Blocks {
+    struct Reb_Deflate_Block *blocks;
+    REBSYM envelope;
+    int level;
+    int strategy;
+};
+
+
+// Compress one block into its room in the output.  This runs off the main
+// thread, so the stream uses zlib's own malloc()-based allocator instead of
+// zalloc() (rebMalloc() can only be used on the interpreter's thread), and
+// errors are left in the block for Deflate_Blocks() to report.
+//
+static void Deflate_Block_Task(void *opaque, REBLEN n)
+{
+    struct Reb_Deflate_Blocks *d = cast(struct Reb_Deflate_Blocks*, opaque);
+    struct Reb_Deflate_Block *b = &d->blocks[n];
+
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.msg = nullptr;
+
+    b->ret = deflateInit2(
+        &strm, d->level, Z_DEFLATED, window_bits_zlib_raw, 8, d->strategy
+    );
+    if (b->ret != Z_OK) {
+        b->msg = strm.msg;
+        return;
+    }
+
+    if (b->dict_len != 0)
+        deflateSetDictionary(
+            &strm, b->in - b->dict_len, cast(uInt, b->dict_len)
+        );
+
+    strm.next_in = cast(const z_Bytef*, b->in);
+    strm.avail_in = cast(uInt, b->len);  // see DEFLATE_MAX_BLOCK_SIZE
+    strm.next_out = b->out;
+    strm.avail_out = cast(uInt, b->out_len);
+
+    int ret = deflate(&strm, b->last ? Z_FINISH : Z_SYNC_FLUSH);
+    bool done = b->last
+        ? ret == Z_STREAM_END
+        : ret == Z_OK and strm.avail_out != 0;  // else flush may be partial
+    if (done) {
+        assert(strm.avail_in == 0);
+        b->out_len -= strm.avail_out;
+
+        if (d->envelope == SYM_GZIP)
+            b->check = crc32_z(0, b->in, b->len);
+        else if (d->envelope == SYM_ZLIB)
+            b->check = adler32_z(1, b->in, b->len);
+    }
+    else {
+        b->ret = (ret == Z_OK or ret == Z_STREAM_END) ? Z_BUF_ERROR : ret;
+        b->msg = strm.msg;
+    }
+
+    deflateEnd(&strm);
+}
+
+
+//
+//  Deflate_Blocks: C
+//
+// Compress input as consecutive pieces of `block_size` bytes, each with its
+// own deflate stream, joined into one valid raw/zlib/gzip stream.  This is
+// the layout `pigz` uses: every block but the last ends on a byte boundary
+// with an empty stored block (Z_SYNC_FLUSH), and the last one has BFINAL.
+//
+// No block depends on the compressor state of another, so they are handed
+// to Run_Tasks() to compress on as many threads as TASK-THREADS allows.  Each
+// one gets room for its worst case in the output buffer, and they are moved
+// together afterward.  The checksums of the blocks are combined here, and the
+// envelope header and trailer written around them (as the streams are raw).
+//
+static REBYTE *Deflate_Blocks(
+    size_t *out_len,
+    const REBYTE *input,
+    size_t in_len,
+    REBSYM envelope,  // SYM_NONE, SYM_ZLIB, or SYM_GZIP
+    int level,
+    int strategy,
+    size_t block_size
+){
+    if (block_size > DEFLATE_MAX_BLOCK_SIZE)
+        block_size = DEFLATE_MAX_BLOCK_SIZE;
+
+    REBLEN num_blocks = (in_len + block_size - 1) / block_size;
+    struct Reb_Deflate_Block *blocks = rebAllocN(
+        struct Reb_Deflate_Block, num_blocks
+    );
+
+    size_t capacity = 10;  // room for the largest (gzip) header
+    size_t offset = 0;
+    REBLEN n;
+    for (n = 0; n < num_blocks; ++n) {
+        struct Reb_Deflate_Block *b = &blocks[n];
+        b->in = input + offset;
+        b->len = MIN(block_size, in_len - offset);
+        b->dict_len = MIN(offset, DEFLATE_DICT_SIZE);
+        b->last = (n == num_blocks - 1);
+        b->out_len = deflateBound(Z_NULL, b->len) + 16;  // zlib's worst case
+        b->out = nullptr;  // set once the output is allocated
+        capacity += b->out_len;
+        offset += b->len;
+    }
+    capacity += 8;  // the largest (gzip) trailer
+
+    REBYTE *output = rebAllocN(REBYTE, capacity);
+
+    size_t room = 10;
+    for (n = 0; n < num_blocks; ++n) {
+        blocks[n].out = output + room;
+        room += blocks[n].out_len;
+    }
+
+    if (level == Z_DEFAULT_COMPRESSION)
+        level = 6;  // as zlib normalizes it (for the XFL and FLEVEL bits)
+
+    struct Reb_Deflate_Blocks d;
+    d.blocks = blocks;
+    d.envelope = envelope;
+    d.level = level;
+    d.strategy = strategy;
+    Run_Tasks(&Deflate_Block_Task, &d, num_blocks);
+
+    for (n = 0; n < num_blocks; ++n) {
+        if (blocks[n].ret == Z_OK)
+            continue;
+
+        if (blocks[n].ret == Z_MEM_ERROR)  // malloc(), not rebMalloc()
+            fail (Error_No_Memory(cast(REBLEN, blocks[n].len)));
+
+        z_stream strm;  // Error_Compression() takes the message from this
+        strm.msg = m_cast(char*, blocks[n].msg);
+        fail (Error_Compression(&strm, blocks[n].ret));
+    }
+
+    size_t used = 0;
+    if (envelope == SYM_GZIP) {
+        const REBYTE header[10] = {
+            0x1F, 0x8B,  // magic number
+            8,  // CM (deflate)
+            0,  // FLG (no name, comment, etc.)
+            0, 0, 0, 0,  // MTIME (not available)
+            cast(REBYTE,  // XFL, the same as zlib's deflate() writes
+                level == 9 ? 2
+                    : (strategy >= Z_HUFFMAN_ONLY or level < 2) ? 4
+                    : 0
+            ),
+            OS_CODE  // also as zlib writes it
+        };
+        memcpy(output, header, 10);
+        used = 10;
+    }
+    else if (envelope == SYM_ZLIB) {
+        int flevel;
+        if (strategy >= Z_HUFFMAN_ONLY or level < 2)
+            flevel = 0;  // FLEVEL is informative only, as zlib figures it
+        else if (level < 6)
+            flevel = 1;
+        else if (level == 6)
+            flevel = 2;
+        else
+            flevel = 3;
+        unsigned header = (0x78 << 8) | (flevel << 6);
+        header += 31 - (header % 31);  // FCHECK
+        output[0] = cast(REBYTE, header >> 8);
+        output[1] = cast(REBYTE, header & 0xFF);
+        used = 2;
+    }
+
+    uLong check = (envelope == SYM_ZLIB) ? adler32(0, nullptr, 0) : 0;
+
+    for (n = 0; n < num_blocks; ++n) {
+        struct Reb_Deflate_Block *b = &blocks[n];
+        memmove(output + used, b->out, b->out_len);  // may overlap
+        used += b->out_len;
+
+        if (envelope == SYM_GZIP)
+            check = crc32_combine(check, b->check, cast(z_off_t, b->len));
+        else if (envelope == SYM_ZLIB)
+            check = adler32_combine(check, b->check, cast(z_off_t, b->len));
+    }
+
+    rebFree(blocks);
+
+    if (envelope == SYM_GZIP) {  // CRC32 and size mod 2^32, least first
+        uint32_t size32 = cast(uint32_t, in_len);
+        int i;
+        for (i = 0; i < 4; ++i)
+            output[used++] = cast(REBYTE, (check >> (8 * i)) & 0xFF);
+        for (i = 0; i < 4; ++i)
+            output[used++] = cast(REBYTE, (size32 >> (8 * i)) & 0xFF);
+    }
+    else if (envelope == SYM_ZLIB) {  // ADLER32, most significant byte first
+        int i;
+        for (i = 3; i >= 0; --i)
+            output[used++] = cast(REBYTE, (check >> (8 * i)) & 0xFF);
+    }
+
+    *out_len = used;
+    return output;
+}
+
+
 //
 //  Compress_Alloc_Core: C
 //
 // Common code for compressing raw deflate, zlib envelope, gzip envelope.
 // Exported as rebDeflateAlloc() and rebGunzipAlloc() for clarity.
 //
+// The level is 0 (no compression) to 9 (best), or -1 for zlib's default.
+// Strategy is one of zlib's tunings for kinds of data (see the DEFLATE
+// native), and a nonzero block size compresses in independent blocks.
+//
 unsigned char *Compress_Alloc_Core(
     size_t *out_len,
     const void* input,
     size_t in_len,
-    REBSTR *envelope // NONE, ZLIB, or GZIP... null defaults GZIP
+    REBSTR *envelope, // NONE, ZLIB, or GZIP... null defaults GZIP
+    int level,
+    REBSTR *strategy, // FILTERED, HUFFMAN-ONLY, RLE, FIXED... null default
+    size_t block_size
 ){
     z_stream strm;
     strm.zalloc = &zalloc; // fail() cleans up automatically, see notes
@@ -167,13 +413,67 @@ unsigned char *Compress_Alloc_Core(
     // if you want it to pick what the library author considers the "worth it"
     // tradeoff of time to generally suggest.
     //
+    assert(level == Z_DEFAULT_COMPRESSION or (level >= 0 and level <= 9));
+
+    int z_strategy = Z_DEFAULT_STRATEGY;
+    if (strategy) {
+        switch (STR_SYMBOL(strategy)) {
+          case SYM_DEFAULT:
+            break;
+
+          case SYM_FILTERED:  // data from a predictor, e.g. PNG rows
+            z_strategy = Z_FILTERED;
+            break;
+
+          case SYM_HUFFMAN_ONLY:  // no string matching
+            z_strategy = Z_HUFFMAN_ONLY;
+            break;
+
+          case SYM_RLE:  // matches only of the previous byte
+            z_strategy = Z_RLE;
+            break;
+
+          case SYM_FIXED:  // no dynamic Huffman tables
+            z_strategy = Z_FIXED;
+            break;
+
+          default:
+            assert(false); // release build keeps default
+        }
+    }
+
+    if (in_len > DEFLATE_MAX_BLOCK_SIZE and block_size == 0)
+        block_size = DEFLATE_MAX_BLOCK_SIZE;  // z_stream sizes are 32-bit
+
+    if (block_size != 0 and in_len > block_size) {
+        REBSYM sym = SYM_GZIP;
+        if (window_bits == window_bits_zlib_raw)
+            sym = SYM_NONE;
+        else if (window_bits == window_bits_zlib)
+            sym = SYM_ZLIB;
+
+        size_t len;
+        REBYTE *output = Deflate_Blocks(
+            &len,
+            cast(const REBYTE*, input),
+            in_len,
+            sym,
+            level,
+            z_strategy,
+            block_size
+        );
+        if (out_len)
+            *out_len = len;
+        return output;
+    }
+
     int ret_init = deflateInit2(
         &strm,
-        Z_DEFAULT_COMPRESSION,
+        level,
         Z_DEFLATED,
         window_bits,
         8,
-        Z_DEFAULT_STRATEGY
+        z_strategy
     );
     if (ret_init != Z_OK)
         fail (Error_Compression(&strm, ret_init));
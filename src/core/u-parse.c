@@ -2276,6 +2276,44 @@ REBNATIVE(subparse)
                     fail (Error_Parse_Rule());
                 }
             }
+            else if (
+                IS_BITSET(rule)
+                and maxcount > 1
+                and not IS_SER_ARRAY(P_INPUT)
+            ){
+                // Charset repeats like `some alpha` are where tokenizers
+                // spend their time, so the whole run of matches is spanned
+                // at once instead of a Parse_One_Rule() call per character.
+                //
+                REBLEN limit = SER_LEN(P_INPUT) - P_POS;
+                if (limit > cast(REBLEN, maxcount - count))
+                    limit = maxcount - count;
+
+                const bool want = true;  // count characters *in* the set
+                REBLEN n;
+                if (P_TYPE == REB_BINARY)
+                    n = Span_Bitset_Bytes(
+                        BIN_AT(P_INPUT, P_POS),
+                        limit,
+                        VAL_BITSET(rule),
+                        not P_HAS_CASE,
+                        want
+                    );
+                else
+                    n = Span_Bitset_Utf8(
+                        cast(REBYTE*, STR_AT(STR(P_INPUT), P_POS)),
+                        limit,
+                        VAL_BITSET(rule),
+                        not P_HAS_CASE,
+                        want
+                    );
+
+                count += n;
+                P_POS += n;
+                if (count < mincount)
+                    P_POS = NOT_FOUND;  // number of matches was not enough
+                break;
+            }
             else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
 
                 DECLARE_ARRAY_FEED (subrules_feed,
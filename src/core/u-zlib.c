@@ -42,6 +42,38 @@
 #include "sys-zlib.h" /* REBOL: see make-zlib.r */
 #define local static
 
+/* REBOL: The "fast path" sections below are by-hand additions to the zlib
+ * extraction, which make-zlib.r does not produce (see its Notes).  They give
+ * the same results as the reference code they sit in front of:
+ *
+ * - crc32_z() folds 64 bytes at a time with carry-less multiplication
+ *   (PCLMULQDQ), on x86-64 CPUs which have it
+ * - adler32_z() sums 32 bytes at a time with SSSE3, on x86-64 CPUs
+ * - longest_match() compares 8 bytes at a time on little-endian machines
+ * - inflate_fast() copies matches 8 bytes at a time when they don't overlap
+ *   (runs of one byte are a memset()), and copies from the window in bulk
+ *
+ * The x86 paths are chosen at runtime with CPUID, so a build still runs on
+ * CPUs without the instructions.
+ */
+#include <stdint.h>
+
+#include "sys-cpu.h" /* REBOL: CPU_TARGET(), Cpu_Has() */
+
+#if !defined(__TINYC__) && (defined(__GNUC__) || defined(__clang__)) \
+    && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define Z_CTZ64(x) ((unsigned)__builtin_ctzll(x))
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+local unsigned z_ctz64(
+    uint64_t x)
+{
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (unsigned)index;
+}
+#  define Z_CTZ64(x) z_ctz64(x)
+#endif
+
 /* crc32.c -- compute the CRC-32 of a data stream
  * Copyright (C) 1995-2006, 2010, 2011, 2012, 2016 Mark Adler
  * For conditions of distribution and use, see copyright notice in zlib.h
@@ -682,6 +714,101 @@ const z_crc_t FAR * ZEXPORT get_crc_table()
 #define DO1 crc = crc_table[0][((int)crc ^ (*buf++)) & 0xff] ^ (crc >> 8)
 #define DO8 DO1; DO1; DO1; DO1; DO1; DO1; DO1; DO1
 
+#ifdef CPU_X86_DISPATCH /* REBOL: fast path */
+/* =========================================================================
+ * CRC-32 of len bytes (a multiple of 16, and at least 64) by folding with
+ * carry-less multiplication, then a Barrett reduction.  The constants are
+ * the bit-reflected ones from Intel's "Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ Instruction".  The crc is not pre- or post-
+ * conditioned here.
+ */
+CPU_TARGET("sse4.1,pclmul")
+local uint32_t crc32_pclmul(
+    const unsigned char FAR *buf,
+    z_size_t len,
+    uint32_t crc)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    buf += 64;
+    len -= 64;
+
+    /* fold four 128-bit lanes in parallel while there are 64 bytes */
+    x0 = k1k2;
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        buf += 64;
+        len -= 64;
+    }
+
+    /* fold the four lanes into one */
+    x0 = k3k4;
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* fold in any remaining 16-byte blocks */
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
+    }
+
+    /* fold 128 bits to 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x0 = k5k0;
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduce to 32 bits */
+    x0 = poly;
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+#endif /* CPU_X86_DISPATCH */
+
 /* ========================================================================= */
 unsigned long ZEXPORT crc32_z(
     unsigned long crc,
@@ -690,6 +817,16 @@ unsigned long ZEXPORT crc32_z(
 {
     if (buf == Z_NULL) return 0UL;
 
+#ifdef CPU_X86_DISPATCH /* REBOL: fast path */
+    if (len >= 64 && Cpu_Has(CPU_PCLMUL | CPU_SSE41)) {
+        z_size_t chunk = len & ~(z_size_t)15;
+        crc = ~crc32_pclmul(buf, chunk, ~(uint32_t)crc);
+        buf += chunk;
+        len -= chunk;
+        if (len == 0) return crc;
+    }
+#endif
+
 #ifdef DYNAMIC_CRC_TABLE
     if (crc_table_empty)
         make_crc_table();
@@ -987,6 +1124,78 @@ local uLong adler32_combine_ OF((uLong adler1, uLong adler2, z_off64_t len2));
 #  define MOD63(a) a %= BASE
 #endif
 
+#ifdef CPU_X86_DISPATCH /* REBOL: fast path */
+/* =========================================================================
+ * Adler-32 with SSSE3, 32 bytes per step: the bytes are summed for adler,
+ * and multiplied by their distance from the end of the step (32 down to 1)
+ * and summed for sum2.  Each step also adds 32 times the adler from before
+ * it to sum2, which is deferred to one shift per NMAX span.
+ */
+CPU_TARGET("ssse3")
+local uLong adler32_ssse3(
+    uLong adler,
+    const Bytef *buf,
+    z_size_t len)
+{
+    unsigned long s1 = adler & 0xffff;
+    unsigned long s2 = (adler >> 16) & 0xffff;
+    z_size_t blocks = len / 32;
+    len -= blocks * 32;
+
+    while (blocks) {
+        const __m128i tap1 = _mm_setr_epi8(
+            32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+        const __m128i tap2 = _mm_setr_epi8(
+            16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i v_ps, v_s1, v_s2;
+
+        unsigned n = NMAX / 32;  /* most steps before s2 must be reduced */
+        if (n > blocks)
+            n = (unsigned)blocks;
+        blocks -= n;
+
+        v_ps = _mm_set_epi32(0, 0, 0, (int)(s1 * n));
+        v_s2 = _mm_set_epi32(0, 0, 0, (int)s2);
+        v_s1 = _mm_setzero_si128();
+        do {
+            __m128i bytes1 = _mm_loadu_si128((const __m128i *)buf);
+            __m128i bytes2 = _mm_loadu_si128((const __m128i *)(buf + 16));
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+            v_s2 = _mm_add_epi32(v_s2,
+                _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+            v_s2 = _mm_add_epi32(v_s2,
+                _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones));
+            buf += 32;
+        } while (--n);
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        /* sum the four 32-bit lanes of each */
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0xB1));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0x4E));
+        s1 += (uint32_t)_mm_cvtsi128_si32(v_s1);
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0xB1));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0x4E));
+        s2 = (uint32_t)_mm_cvtsi128_si32(v_s2);
+
+        s1 %= BASE;
+        s2 %= BASE;
+    }
+
+    while (len--) {  /* fewer than 32 bytes, so no overflow */
+        s1 += *buf++;
+        s2 += s1;
+    }
+    s1 %= BASE;
+    s2 %= BASE;
+
+    return s1 | (s2 << 16);
+}
+#endif /* CPU_X86_DISPATCH */
+
 /* ========================================================================= */
 uLong ZEXPORT adler32_z(
     uLong adler,
@@ -1027,6 +1236,11 @@ uLong ZEXPORT adler32_z(
         return adler | (sum2 << 16);
     }
 
+#ifdef CPU_X86_DISPATCH /* REBOL: fast path */
+    if (len >= 64 && Cpu_Has(CPU_SSSE3))
+        return adler32_ssse3(adler | (sum2 << 16), buf, len);
+#endif
+
     /* do length NMAX blocks -- requires just one modulo operation */
     while (len >= NMAX) {
         len -= NMAX;
@@ -2454,6 +2668,27 @@ local uInt longest_match(
         scan += 2, match++;
         Assert(*scan == *match, "match[2]?");
 
+#ifdef Z_CTZ64 /* REBOL: fast path */
+        /* Compare 8 bytes at a time; the first differing bit of the XOR is
+         * in the first differing byte.  scan stops on the first mismatch,
+         * or at strend, just as in the loop below.
+         */
+        scan++, match++;
+        while (scan + 8 <= strend) {
+            uint64_t a, b;
+            zmemcpy(&a, scan, 8);
+            zmemcpy(&b, match, 8);
+            if (a != b) {
+                scan += Z_CTZ64(a ^ b) >> 3;
+                break;
+            }
+            scan += 8, match += 8;
+        }
+        if (scan + 8 > strend) {
+            while (scan < strend && *scan == *match)
+                scan++, match++;
+        }
+#else
         /* We check for insufficient lookahead only every 8th comparison;
          * the 256th check will be made at strstart+258.
          */
@@ -2463,6 +2698,7 @@ local uInt longest_match(
                  *++scan == *++match && *++scan == *++match &&
                  *++scan == *++match && *++scan == *++match &&
                  scan < strend);
+#endif
 
         Assert(scan <= s->window+(unsigned)(s->window_size-1), "wild scan");
 
@@ -5816,9 +6052,9 @@ void ZLIB_INTERNAL inflate_fast(
                         from += wsize - op;
                         if (op < len) {         /* some from window */
                             len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
+                            zmemcpy(out, from, op);  /* REBOL: fast path */
+                            out += op;
+                            from += op;
                             from = out - dist;  /* rest from output */
                         }
                     }
@@ -5827,16 +6063,16 @@ void ZLIB_INTERNAL inflate_fast(
                         op -= wnext;
                         if (op < len) {         /* some from end of window */
                             len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
+                            zmemcpy(out, from, op);  /* REBOL: fast path */
+                            out += op;
+                            from += op;
                             from = window;
                             if (wnext < len) {  /* some from start of window */
                                 op = wnext;
                                 len -= op;
-                                do {
-                                    *out++ = *from++;
-                                } while (--op);
+                                zmemcpy(out, from, op);  /* REBOL: */
+                                out += op;
+                                from += op;
                                 from = out - dist;      /* rest from output */
                             }
                         }
@@ -5845,9 +6081,9 @@ void ZLIB_INTERNAL inflate_fast(
                         from += wnext - op;
                         if (op < len) {         /* some from window */
                             len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
+                            zmemcpy(out, from, op);  /* REBOL: fast path */
+                            out += op;
+                            from += op;
                             from = out - dist;  /* rest from output */
                         }
                     }
@@ -5863,6 +6099,23 @@ void ZLIB_INTERNAL inflate_fast(
                             *out++ = *from++;
                     }
                 }
+                else if (dist >= 8) {  /* REBOL: fast path */
+                    from = out - dist;          /* copy direct from output */
+                    while (len >= 8) {          /* 8 bytes don't overlap */
+                        zmemcpy(out, from, 8);
+                        out += 8;
+                        from += 8;
+                        len -= 8;
+                    }
+                    while (len) {
+                        *out++ = *from++;
+                        len--;
+                    }
+                }
+                else if (dist == 1) {  /* REBOL: fast path */
+                    memset(out, out[-1], len);  /* run of one byte */
+                    out += len;
+                }
                 else {
                     from = out - dist;          /* copy direct from output */
                     do {                        /* minimum length is three */
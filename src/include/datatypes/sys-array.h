@@ -84,6 +84,20 @@ inline static REBARR *Singular_From_Cell(const REBCEL *v) {
     return singular;
 }
 
+// Cells of a copy-on-write array live in storage that other arrays borrow
+// too (see Share_Series_Data()), so anything that writes them in place must
+// have asked for a private copy first.  Cells don't know what array they're
+// in, so the check is made by the array-level routines handing out or
+// terminating cells for writing.
+//
+#ifdef NDEBUG
+    #define ASSERT_ARRAY_UNSHARED(a) NOOP
+#else
+    #define ASSERT_ARRAY_UNSHARED(a) \
+        assert(NOT_SERIES_INFO((a), SHARED))
+#endif
+
+
 // As with an ordinary REBSER, a REBARR has separate management of its length
 // and its terminator.  Many routines seek to choose the precise moment to
 // sync these independently for performance reasons (for better or worse).
@@ -106,6 +120,7 @@ inline static void TERM_ARRAY_LEN(REBARR *a, REBLEN len) {
     SET_SERIES_LEN(SER(a), len);
 
   #if !defined(NDEBUG)
+    ASSERT_ARRAY_UNSHARED(a);  // would stomp a cell others are borrowing
     if (NOT_END(ARR_AT(a, len)))
         ASSERT_CELL_WRITABLE_EVIL_MACRO(ARR_AT(a, len), __FILE__, __LINE__);
   #endif
@@ -478,6 +493,22 @@ inline static RELVAL *VAL_ARRAY_AT(const REBCEL *v) {
     return ARR_AT(VAL_ARRAY(v), VAL_INDEX(v));
 }
 
+// Binding rewrites cells in place without going through FAIL_IF_READ_ONLY(),
+// so it has to explicitly ask for a private copy of a copy-on-write array.
+// (See Copy_Array_Shared_Managed())
+//
+inline static RELVAL *VAL_ARRAY_AT_UNSHARED(const REBCEL *v) {
+    Unshare_Series_If_Shared(SER(VAL_ARRAY(v)));
+    ASSERT_ARRAY_UNSHARED(VAL_ARRAY(v));
+    return VAL_ARRAY_AT(v);
+}
+
+inline static RELVAL *VAL_ARRAY_HEAD_UNSHARED(const REBCEL *v) {
+    Unshare_Series_If_Shared(SER(VAL_ARRAY(v)));
+    ASSERT_ARRAY_UNSHARED(VAL_ARRAY(v));
+    return VAL_ARRAY_HEAD(v);
+}
+
 #define VAL_ARRAY_LEN_AT(v) \
     VAL_LEN_AT(v)
 
@@ -47,6 +47,25 @@ inline static void INIT_BITS_NOT(REBSER *s, bool negated)
   { MISC(s).negated = negated; }
 
 
+// Scanning loops test many characters against the same bitset, and going
+// through Check_Bit() for each one means re-checking the series length and
+// looking up both cases of every character.  So loops over input which is
+// long enough to amortize it make a copy of the bits for byte values up
+// front, with negation and ASCII case folding already applied.  Codepoints
+// above ASCII still go through Check_Bit() when folding, since Latin-1 case
+// pairs don't line up like ASCII's (see Init_Byte_Bits()).
+//
+struct Reb_Byte_Bits {
+    REBYTE bits[32];  // one bit per byte value, high bit first
+    bool folded;  // only the bits for ASCII are valid if true
+};
+
+inline static bool Check_Byte_Bit(const struct Reb_Byte_Bits *bb, REBYTE b) {
+    assert(b < 0x80 or not bb->folded);
+    return did (bb->bits[b >> 3] & (0x80 >> (b & 7)));
+}
+
+
 inline static REBBIN *VAL_BITSET(const REBCEL *v) {
     assert(CELL_KIND(v) == REB_BITSET);
     return SER(VAL_NODE(v));
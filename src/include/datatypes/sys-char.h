@@ -214,6 +214,123 @@ inline static REBUNI UP_CASE(REBUNI c)
 inline static REBUNI LO_CASE(REBUNI c)
   { return c < UNICODE_CASES ? Lower_Cases[c] : c; }
 
+
+//=//// WORD-AT-A-TIME ASCII //////////////////////////////////////////////=//
+//
+// Loops over UTF-8 spend most of their time on ASCII, which can be handled a
+// machine word at a time: a word is all ASCII if none of its bytes has the
+// high bit set, and ASCII letters can be case mapped in-register with a bit
+// of arithmetic ("SWAR", SIMD Within A Register).  Words are loaded with
+// memcpy(), as string data needn't be aligned (compilers make it one load).
+//
+// On x86-64 the same is done 16 bytes at a time with SSE2, which every such
+// CPU has (see %sys-cpu.h).  The word versions then only handle the ends.
+//
+
+#define SWAR_ONES (UINTPTR_MAX / 0xFF)  // 0x0101...01
+#define SWAR_HIGHS (SWAR_ONES * 0x80)  // 0x8080...80
+
+// Nonzero if any byte of `w` is zero.  Applied to `w ^ (SWAR_ONES * b)` it
+// tells if any byte of `w` is `b`.
+//
+#define SWAR_HAS_ZERO_BYTE(w) \
+    (((w) - SWAR_ONES) & ~(w) & SWAR_HIGHS)
+
+inline static uintptr_t Swar_Load(const REBYTE *bp) {
+    uintptr_t w;
+    memcpy(&w, bp, sizeof(uintptr_t));
+    return w;
+}
+
+// Lowercase the ASCII letters in a word whose bytes are all ASCII.  Adding
+// to a byte under 0x80 can't carry into the next one, so the high bit of
+// each byte of the sums says if it was >= 'A', and if it was > 'Z'.
+//
+inline static uintptr_t Swar_Lower_Ascii(uintptr_t w) {
+    assert(not (w & SWAR_HIGHS));
+    uintptr_t at_least_A = w + SWAR_ONES * (0x80 - 'A');
+    uintptr_t above_Z = w + SWAR_ONES * (0x80 - 'Z' - 1);
+    return w | ((at_least_A & ~above_Z & SWAR_HIGHS) >> 2);  // 0x80 >> 2
+}
+
+inline static uintptr_t Swar_Upper_Ascii(uintptr_t w) {
+    assert(not (w & SWAR_HIGHS));
+    uintptr_t at_least_a = w + SWAR_ONES * (0x80 - 'a');
+    uintptr_t above_z = w + SWAR_ONES * (0x80 - 'z' - 1);
+    return w & ~((at_least_a & ~above_z & SWAR_HIGHS) >> 2);
+}
+
+#ifdef CPU_X86_SSE2
+    //
+    // SSE2 only has signed byte compares, but for ASCII those are the same.
+    //
+    inline static __m128i Sse2_Lower_Ascii(__m128i x) {
+        __m128i letters = _mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)),
+            _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1))
+        );
+        return _mm_or_si128(x, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+    }
+
+    inline static __m128i Sse2_Upper_Ascii(__m128i x) {
+        __m128i letters = _mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8('a' - 1)),
+            _mm_cmplt_epi8(x, _mm_set1_epi8('z' + 1))
+        );
+        return _mm_andnot_si128(
+            _mm_and_si128(letters, _mm_set1_epi8(0x20)), x
+        );
+    }
+#endif
+
+// Size of the run of ASCII bytes at `bp` (stopping at `end`).  Loops that
+// have a fast path for ASCII use this to find out how much of the input they
+// can take that path for, 32 bytes at a time, before they have to decode a
+// codepoint the slow way.
+//
+inline static REBSIZ Ascii_Run_Size(const REBYTE *bp, const REBYTE *end) {
+    const REBYTE *start = bp;
+    const REBINT word = sizeof(uintptr_t);
+
+  #ifdef CPU_X86_SSE2
+    while (end - bp >= 32) {
+        __m128i x = _mm_or_si128(
+            _mm_loadu_si128(cast(const __m128i*, bp)),
+            _mm_loadu_si128(cast(const __m128i*, bp + 16))
+        );
+        if (_mm_movemask_epi8(x) != 0)  // gathers the high bits
+            break;
+        bp += 32;
+    }
+    while (end - bp >= 16) {
+        int highs = _mm_movemask_epi8(
+            _mm_loadu_si128(cast(const __m128i*, bp))
+        );
+        if (highs != 0) {
+            for (; not (highs & 1); highs >>= 1)
+                ++bp;
+            return bp - start;
+        }
+        bp += 16;
+    }
+  #else
+    while (end - bp >= 4 * word) {
+        uintptr_t w = Swar_Load(bp) | Swar_Load(bp + word)
+            | Swar_Load(bp + 2 * word) | Swar_Load(bp + 3 * word);
+        if (w & SWAR_HIGHS)
+            break;
+        bp += 4 * word;
+    }
+  #endif
+    while (end - bp >= word and not (Swar_Load(bp) & SWAR_HIGHS))
+        bp += word;
+    while (bp != end and *bp < 0x80)
+        ++bp;
+
+    return bp - start;
+}
+
+
 inline static bool IS_WHITE(REBUNI c)
   { return c <= 32 and ((White_Chars[c] & 1) != 0); }
 
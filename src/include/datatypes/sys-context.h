@@ -106,6 +106,18 @@
 #define LINK_ANCESTOR_NODE(s)       LINK(s).custom.node
 #define LINK_ANCESTOR(s)            ARR(LINK_ANCESTOR_NODE(s))
 
+// Objects which share a keylist have the same "shape", so a lookup table
+// for their keys only needs to be built once.  On the keylist of an object
+// (not a paramlist, whose MISC() is the action's meta) with enough keys that
+// it has been searched, this points at a managed "keyhash" series mapping
+// canon spelling hashes to key indices.  It is present when the keylist
+// has SERIES_FLAG_MISC_NODE_NEEDS_MARK (see Find_Canon_In_Context())
+//
+#define MISC_KEYHASH_NODE(s)        MISC(s).custom.node
+#define MISC_KEYHASH(s)             SER(MISC_KEYHASH_NODE(s))
+
+#define MIN_KEYS_FOR_KEYHASH 16  // a linear scan of fewer keys is as fast
+
 
 #define CTX_VARLIST(c) \
     (&(c)->varlist)
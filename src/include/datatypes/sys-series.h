@@ -488,6 +488,15 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 }
 
 
+// A copy-on-write series is not read-only, so FAIL_IF_READ_ONLY_SER() doubles
+// as the write barrier: whoever asks to modify it gets a private copy.
+//
+inline static void Unshare_Series_If_Shared(REBSER *s) {
+    if (GET_SERIES_INFO(s, SHARED))
+        Unshare_Series(s);
+}
+
+
 // Gives the appropriate kind of error message for the reason the series is
 // read only (frozen, running, protected, locked to be a map key...)
 //
@@ -497,8 +506,10 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 //
 
 inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
-    if (not Is_Series_Read_Only(s))
+    if (not Is_Series_Read_Only(s)) {
+        Unshare_Series_If_Shared(s);
         return;
+    }
 
     if (GET_SERIES_INFO(s, AUTO_LOCKED))
         fail (Error_Series_Auto_Locked_Raw());
@@ -284,6 +284,11 @@ typedef enum {
 #define PHF_MASK_NONE 0
 typedef bool (PARAM_HOOK)(REBVAL *v, REBFLGS flags, void *opaque);
 
+// Work that Run_Tasks() may call on a worker thread, with the index of the
+// task to do.  It can't use the interpreter at all (see %c-thread.c).
+//
+typedef void (TASK_CFUNC)(void *opaque, REBLEN index);
+
 
 // These definitions are needed in %sys-rebval.h, and can't be put in
 // %sys-rebact.h because that depends on Reb_Array, which depends on
@@ -22,23 +22,19 @@
 //
 // R3-Alpha had a per-thread "bind table"; a large and sparsely populated hash
 // into which index numbers would be placed, for what index those words would
-// have as keys or parameters.  Ren-C's strategy is that binding information
-// is wedged into REBSER nodes that represent the canon words themselves.
-//
-// This would create problems if multiple threads were trying to bind at the
-// same time.  While threading was never realized in R3-Alpha, Ren-C doesn't
-// want to have any "less of a plan".  So the Reb_Binder is used by binding
-// clients as a placeholder for whatever actual state would be used to augment
-// the information in the canon word series about which client is making a
-// request.  This could be coupled with some kind of lockfree adjustment
-// strategy whereby a word that was contentious would cause a structure to
-// "pop out" and be pointed to by some atomic thing inside the word.
-//
-// For the moment, a binder has some influence by saying whether the high 16
-// bits or low 16 bits of the canon's misc.index are used.  If the index
-// were atomic this would--for instance--allow two clients to bind at once.
-// It's just a demonstration of where more general logic using atomics
-// that could work for N clients would be.
+// have as keys or parameters.  Ren-C's strategy was originally to wedge the
+// binding information into the REBSER nodes of the canon words themselves,
+// with a 16-bit "high" and "low" half so two clients could bind at once.
+//
+// That would create problems if multiple threads were trying to bind at the
+// same time, it limited indices to 16 bits, and it meant any error raised in
+// the middle of a bind had to go find the canons and zero them back out.  So
+// each Reb_Binder now has its own "side table": a small open-addressed hash
+// from canon pointer to index.  Binders don't touch the canons at all, and
+// any number of them may be active at once.  It starts out in storage inside
+// the binder itself (so the common case of binding a few words to a small
+// context does no allocation), and moves to an unmanaged series if it has to
+// grow.  That series is freed by the trap cleanup if a fail() interrupts.
 //
 // The debug build also adds another feature, that makes sure the clear count
 // matches the set count.
@@ -170,17 +166,27 @@ enum {
 };
 
 
+#define BINDER_INLINE_SHIFT 27  // 32 - 5, so 2^5 slots without allocating
+#define BINDER_INLINE_SLOTS 32
+
+struct Reb_Binder_Entry {
+    REBSTR *canon;  // nullptr if the slot is vacant
+    REBINT index;  // may be negative, sign can encode a property of binding
+};
+
 struct Reb_Binder {
-    bool high;
-  #if !defined(NDEBUG)
+    struct Reb_Binder_Entry *slots;  // inline_slots, or the table's data
+    REBSER *table;  // unmanaged series, if grown past the inline slots
+    REBLEN shift;  // 32 - log2(number of slots), for Fibonacci hashing
     REBLEN count;
-  #endif
+
+    struct Reb_Binder_Entry inline_slots[BINDER_INLINE_SLOTS];
 
   #if defined(CPLUSPLUS_11)
     //
     // The C++ debug build can help us make sure that no binder ever fails to
     // get an INIT_BINDER() and SHUTDOWN_BINDER() pair called on it, which
-    // would leave lingering binding values on REBSER nodes.
+    // would leak its table if it had grown.
     //
     bool initialized;
     Reb_Binder () { initialized = false; }
@@ -188,30 +194,70 @@ struct Reb_Binder {
   #endif
 };
 
+#define BINDER_NUM_SLOTS(binder) \
+    (cast(REBLEN, 1) << (32 - (binder)->shift))
 
-inline static void INIT_BINDER(struct Reb_Binder *binder) {
-    binder->high = true; // !!! what about `did (SPORADICALLY(2))` to test?
 
-  #if !defined(NDEBUG)
+inline static void INIT_BINDER(struct Reb_Binder *binder) {
+    binder->slots = binder->inline_slots;
+    binder->table = nullptr;
+    binder->shift = BINDER_INLINE_SHIFT;
     binder->count = 0;
+    memset(binder->inline_slots, 0, sizeof(binder->inline_slots));
+
+  #ifdef CPLUSPLUS_11
+    binder->initialized = true;
+  #endif
 
-    #ifdef CPLUSPLUS_11
-        binder->initialized = true;
-    #endif
+  #if !defined(NDEBUG)
+    ++TG_Num_Binders;
   #endif
 }
 
 
 inline static void SHUTDOWN_BINDER(struct Reb_Binder *binder) {
-  #if !defined(NDEBUG)
     assert(binder->count == 0);
 
-    #ifdef CPLUSPLUS_11
-        binder->initialized = false;
-    #endif
+    if (binder->table)
+        Free_Unmanaged_Series(binder->table);
+
+  #ifdef CPLUSPLUS_11
+    binder->initialized = false;
+  #endif
+
+  #if !defined(NDEBUG)
+    assert(TG_Num_Binders != 0);
+    --TG_Num_Binders;
   #endif
+}
+
+
+// Canons are series nodes from a pool, so the low bits of their addresses
+// are all the same.  Multiplying by 2^32 divided by the golden ratio and
+// taking the high bits spreads them out ("Fibonacci hashing").
+//
+inline static REBLEN Binder_Home_Slot(
+    struct Reb_Binder *binder,
+    REBSTR *canon
+){
+    uint32_t bits = cast(uint32_t, cast(uintptr_t, canon) >> 3);
+    return cast(uint32_t, bits * 2654435769u) >> binder->shift;
+}
 
-    UNUSED(binder);
+
+inline static struct Reb_Binder_Entry *Binder_Entry(
+    struct Reb_Binder *binder,
+    REBSTR *canon
+){
+    REBLEN mask = BINDER_NUM_SLOTS(binder) - 1;
+    REBLEN slot = Binder_Home_Slot(binder, canon);
+    while (
+        binder->slots[slot].canon != nullptr
+        and binder->slots[slot].canon != canon
+    ){
+        slot = (slot + 1) & mask;  // linear probing
+    }
+    return &binder->slots[slot];  // either the canon's entry, or a vacancy
 }
 
 
@@ -224,20 +270,17 @@ inline static bool Try_Add_Binder_Index(
 ){
     assert(index != 0);
     assert(GET_SERIES_INFO(canon, STRING_CANON));
-    if (binder->high) {
-        if (MISC(canon).bind_index.high != 0)
-            return false;
-        MISC(canon).bind_index.high = index;
-    }
-    else {
-        if (MISC(canon).bind_index.low != 0)
-            return false;
-        MISC(canon).bind_index.low = index;
-    }
 
-  #if !defined(NDEBUG)
+    if (binder->count >= BINDER_NUM_SLOTS(binder) / 2)
+        Expand_Binder(binder);  // keep at least half the slots vacant
+
+    struct Reb_Binder_Entry *entry = Binder_Entry(binder, canon);
+    if (entry->canon)
+        return false;
+
+    entry->canon = canon;
+    entry->index = index;
     ++binder->count;
-  #endif
     return true;
 }
 
@@ -259,10 +302,8 @@ inline static REBINT Get_Binder_Index_Else_0( // 0 if not present
 ){
     assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-    if (binder->high)
-        return MISC(canon).bind_index.high;
-    else
-        return MISC(canon).bind_index.low;
+    struct Reb_Binder_Entry *entry = Binder_Entry(binder, canon);
+    return entry->canon ? entry->index : 0;
 }
 
 
@@ -272,24 +313,35 @@ inline static REBINT Remove_Binder_Index_Else_0( // return old value if there
 ){
     assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-    REBINT old_index;
-    if (binder->high) {
-        old_index = MISC(canon).bind_index.high;
-        if (old_index == 0)
-            return 0;
-        MISC(canon).bind_index.high = 0;
-    }
-    else {
-        old_index = MISC(canon).bind_index.low;
-        if (old_index == 0)
-            return 0;
-        MISC(canon).bind_index.low = 0;
+    struct Reb_Binder_Entry *entry = Binder_Entry(binder, canon);
+    if (not entry->canon)
+        return 0;
+
+    REBINT old_index = entry->index;
+
+    // Linear probing can't just vacate the slot, since that would cut off
+    // any entries that had probed past it.  Shift later entries of the run
+    // back into the hole when it's at or after their home slot.
+    //
+    REBLEN mask = BINDER_NUM_SLOTS(binder) - 1;
+    REBLEN hole = entry - binder->slots;
+    REBLEN slot = hole;
+    while (true) {
+        slot = (slot + 1) & mask;
+        REBSTR *moving = binder->slots[slot].canon;
+        if (not moving)
+            break;
+
+        REBLEN home = Binder_Home_Slot(binder, moving);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            binder->slots[hole] = binder->slots[slot];
+            hole = slot;
+        }
     }
+    binder->slots[hole].canon = nullptr;
 
-  #if !defined(NDEBUG)
     assert(binder->count > 0);
     --binder->count;
-  #endif
     return old_index;
 }
 
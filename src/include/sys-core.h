@@ -93,6 +93,8 @@
 #include <math.h>
 #include <stddef.h> // for offsetof()
 
+#include "sys-cpu.h"  // SSE2 for the ASCII loops in %sys-char.h, Cpu_Has()
+
 
 //
 // DISABLE STDIO.H IN RELEASE BUILD
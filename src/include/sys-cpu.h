@@ -0,0 +1,84 @@
+//
+//  File: %sys-cpu.h
+//  Summary: "Runtime detection of x86 instruction set extensions"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Fast paths that need more than SSE2 are compiled only for the functions
+// which use them, with CPU_TARGET("ssse3") etc., so the rest of the build
+// makes no assumptions and runs on any x86-64 CPU.  Whether such a path is
+// taken is decided at runtime with Cpu_Has(), which asks CPUID once.
+//
+// SSE2 is part of x86-64 itself, so CPU_X86_SSE2 code is used unchecked.
+// CPU_X86_DISPATCH is only defined for compilers that can target functions
+// (and not TCC, which builds user natives and has no intrinsics).
+//
+// This is included by the by-hand additions to third-party code (zlib, the
+// JPEG decoder), so it depends on nothing but the compiler's headers.
+//
+
+#ifndef __SYS_CPU_H_
+#define __SYS_CPU_H_
+
+#if !defined(__TINYC__) && (defined(__x86_64__) || defined(_M_X64))
+    #define CPU_X86_SSE2
+    #include <emmintrin.h>
+
+  #if defined(_MSC_VER) || defined(__clang__) \
+    || (defined(__GNUC__) && __GNUC__ >= 5)
+
+    #define CPU_X86_DISPATCH
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define CPU_TARGET(features)  // MSVC allows intrinsics anywhere
+    #else
+        #include <cpuid.h>
+        #define CPU_TARGET(features) __attribute__((target(features)))
+    #endif
+    #include <immintrin.h>
+
+    #define CPU_PCLMUL (1 << 1)  // CPUID leaf 1, ECX bits
+    #define CPU_SSSE3 (1 << 9)
+    #define CPU_SSE41 (1 << 19)
+    #define CPU_SSE42 (1 << 20)
+
+    inline static int Cpu_Has(int flags) {
+        static int cpu_flags = -1;  // checked on first use (racing is benign)
+
+        if (cpu_flags < 0) {
+            unsigned ecx = 0;
+          #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            ecx = (unsigned)info[2];
+          #else
+            unsigned eax, ebx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+                ecx = 0;
+          #endif
+            cpu_flags = (int)(
+                ecx & (CPU_PCLMUL | CPU_SSSE3 | CPU_SSE41 | CPU_SSE42)
+            );
+        }
+        return (cpu_flags & flags) == flags;
+    }
+  #endif
+#endif
+
+#endif  // __SYS_CPU_H_
@@ -71,6 +71,9 @@ PVAR REBYTE *PG_Pool_Map;   // Memory pool size map (created on boot)
 
 PVAR REB_OPTS *Reb_Opts;
 
+PVAR REBLEN PG_Task_Threads;  // Most threads Run_Tasks() uses (0 = not known)
+PVAR bool PG_Tasks_Running;  // Run_Tasks() has threads, so Lock_Tasks() locks
+
 #ifdef DEBUG_HAS_PROBE
     PVAR bool PG_Probe_Failures; // helpful especially for boot errors & panics
 #endif
@@ -201,6 +204,7 @@ TVAR uintptr_t TG_Stack_Limit;    // Limit address for CPU stack.
 
 #if !defined(NDEBUG)
     TVAR intptr_t TG_Num_Black_Series;
+    TVAR REBLEN TG_Num_Binders;  // between INIT_BINDER() and SHUTDOWN_BINDER()
 #endif
 
 // Each time Eval_Core is called a Reb_Frame* is pushed to the "frame stack".
@@ -23,6 +23,19 @@
 
 #define MOLD_BUF TG_Mold_Buf
 
+// A mold with a "sink" does not accumulate its whole output in the mold
+// buffer.  Once MOLD_SINK_CHUNK bytes have built up past the push point, the
+// next value boundary hands them to the sink and the buffer is reset, so a
+// huge structure can be molded to a port with constant memory overhead.
+//
+// The bytes passed to the sink point into the mold buffer, which is not
+// stable if the sink molds anything itself.  Sinks which run arbitrary code
+// (like writing to a PORT!) must copy the data out first.
+//
+typedef void (MOLD_SINK)(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size);
+
+#define MOLD_SINK_CHUNK (64 * 1024)
+
 struct rebol_mold {
     REBSTR *series;     // destination series (utf8)
     REBLEN index;       // codepoint index where mold starts within series
@@ -34,6 +47,8 @@ struct rebol_mold {
     REBYTE period;      // for decimal point
     REBYTE dash;        // for date fields
     REBYTE digits;      // decimal digits
+    MOLD_SINK *sink;    // if not null, output is flushed here in chunks
+    void *sink_data;    // context for the sink (e.g. a PORT! or ACTION!)
 };
 
 #define Drop_Mold_If_Pushed(mo) \
@@ -89,6 +104,7 @@ enum REB_Mold_Opts {
     mold_struct.series = NULL; /* used to tell if pushed or not */ \
     mold_struct.opts = 0; \
     mold_struct.indent = 0; \
+    mold_struct.sink = nullptr; \
     REB_MOLD *name = &mold_struct; \
 
 #define SET_MOLD_FLAG(mo,f) \
@@ -468,9 +468,17 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_SHARED ////////////////////////////////////////////////=//
 //
-#define SERIES_INFO_29 \
+// A "copy-on-write" series does not own its dynamic data.  Its ->data points
+// into the allocation of a hidden holder series (reachable through LINK, so
+// the GC keeps it alive) that may be lent to other series at the same time.
+// Any modification must first give the series its own allocation with
+// Unshare_Series(), which FAIL_IF_READ_ONLY_SER() does automatically.
+//
+// See Copy_Array_Shared_Managed() and Copy_Sequence_Shared_Managed().
+//
+#define SERIES_INFO_SHARED \
     FLAG_LEFT_BIT(29)
 
 
@@ -692,26 +700,15 @@ union Reb_Series_Misc {
     //
     REBLEN length;
 
-    // When binding words into a context, it's necessary to keep a table
-    // mapping those words to indices in the context's keylist.  R3-Alpha
-    // had a global "binding table" for the spellings of words, where
-    // those spellings were not garbage collected.  Ren-C uses REBSERs
-    // to store word spellings, and then has a hash table indexing them.
-    //
-    // So the "binding table" is chosen to be indices reachable from the
-    // REBSER nodes of the words themselves.  If it were necessary for
-    // multiple clients to have bindings at the same time, this could be
-    // done through a pointer that would "pop out" into some kind of
-    // linked list.  For now, the binding API just demonstrates having
-    // up to 2 different indices in effect at once.
+    // Canon symbols cache the case-insensitive hash of their spelling, which
+    // is shared by all their synonyms.  The symbol table compares it before
+    // comparing any UTF-8, rehashes with it when it expands, and it is used
+    // as the hash of ANY-WORD! values in MAP!s.
     //
-    // Note that binding indices can be negative, so the sign can be used
-    // to encode a property of that particular binding.
+    // (This slot used to hold binding indices, but binders now keep those
+    // in their own side tables...see %sys-bind.h)
     //
-    struct {
-        int high:16;
-        int low:16;
-    } bind_index;
+    REBINT hash;
 
     // When copying arrays, it's necessary to keep a map from source series
     // to their corresponding new copied series.  This allows multiple
@@ -719,11 +716,11 @@ union Reb_Series_Misc {
     // appearances of the same *copied* identity in the target, and also is
     // integral to avoiding problems with cyclic structures.
     //
-    // As with the `bind_index` above, the cheapest way to build such a map is
-    // to put the forward into the series node itself.  However, when copying
-    // a generic series the bits are all used up.  So the ->misc field is
-    // temporarily "co-opted"...its content taken out of the node and put into
-    // the forwarding entry.  Then the index of the forwarding entry is put
+    // As with binding indices in the past, the cheapest way to build such a
+    // map is to put the forward into the series node itself.  However, when
+    // copying a generic series the bits are all used up.  So the ->misc field
+    // is temporarily "co-opted"...its content taken out of the node and put
+    // into the forwarding entry.  Then the index of the forwarding entry is put
     // here.  At the end of the copy, all the ->misc fields are restored.
     //
     // !!! This feature was in a development branch that has stalled, but the
@@ -301,6 +301,10 @@ enum {
     SCAN_FLAG_LOCK_SCANNED = 1 << 4  // lock series as they are loaded
 };
 
+// Most pieces Scan_To_Stack_Pieces() will cut a source into (TRANSCODE/PIECES)
+//
+#define MAX_SCAN_PIECES 64
+
 
 //
 // MAXIMUM LENGTHS
@@ -48,4 +48,8 @@ struct Reb_State {
     REBLEN mold_buf_len;
     REBSIZ mold_buf_size;
     REBLEN mold_loop_tail;
+
+  #if !defined(NDEBUG)
+    REBLEN num_binders;  // binders a fail() abandons are never shut down
+  #endif
 };
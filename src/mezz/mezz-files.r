@@ -387,6 +387,54 @@ detab-file: function [
     write filename detab to text! read filename
 ]
 
+transcode-each: function [
+    {Call a handler with each top-level value of UTF-8 data, read in chunks}
+
+    return: <void>
+    source "Port to read from (left open), or FILE!/URL! to open and close"
+        [port! file! url!]
+    handler "Receives each value as it is scanned"
+        [action!]
+    /chunk "Bytes to read at a time (default is 64K)"
+        [integer!]
+][
+    ; LOAD of a large data file needs all the source bytes and the complete
+    ; block of values in memory at once.  This only keeps the chunk being
+    ; scanned (plus any value cut off at its end, which is carried over to
+    ; the next chunk by TRANSCODE/PARTIAL).
+    ;
+    port: either port? source [source] [open source]
+    chunk: default [65536]
+
+    buffer: make binary! chunk
+    line: 1
+    partial: /partial
+
+    ; A value that is still incomplete has to be scanned again from its start
+    ; once more input arrives.  Waiting until the buffer doubles before doing
+    ; so keeps the total rescanning of a value much larger than the chunk
+    ; size proportional to its length (instead of its length squared).
+    ;
+    rescan-at: 0
+
+    while [partial] [
+        data: read/part port chunk
+        if empty? data [partial: _]  ; final scan, errors on incomplete input
+        append buffer data
+
+        if all [partial  rescan-at > length of buffer] [continue]
+
+        pos: transcode/(partial)/line 'values buffer 'line
+        for-each value values [handler :value]
+
+        rescan-at: either empty? values [2 * length of buffer] [0]
+        remove/part buffer pos  ; keep only what wasn't scanned yet
+    ]
+
+    if not port? source [close port]
+]
+
+
 ; temporary location
 set-net: function [
     {sets the system/user/identity email smtp pop3 esmtp-usr esmtp-pass fqdn}
@@ -39,6 +39,7 @@ save: function [
     /length "Save the length of the script content in the header"
     /compress "true = compressed, false = not, 'script = encoded string"
         [logic! word!]
+    /binary "Save in compact binary format (read back with LOAD/BINARY)"
 ][
     ; Recover common natives for words used as refinements.
     all_SAVE: all
@@ -47,6 +48,7 @@ save: function [
     ; Special datatypes use codecs directly (e.g. PNG image file):
     all [
         not header  ; User wants to save value as script, not data file
+        not binary
         match [file! url!] where
         type: file-type? where
         type <> 'rebol  ; handled by this routine, not by WRITE+ENCODE
@@ -55,6 +57,19 @@ save: function [
         return write where encode type :value
     ]
 
+    if binary [  ; SERIALIZE writes its own header, has nowhere for options
+        if any [header length compress] [
+            fail "SAVE/BINARY can't be used with /HEADER /LENGTH or /COMPRESS"
+        ]
+        data: serialize :value
+        return case [
+            match [file! url!] where [write where data]
+            blank? where [data]
+        ] else [
+            insert tail of where data
+        ]
+    ]
+
     any [length compress] then [  ; need header if compressed or lengthed
         header: default [[]]
     ]
@@ -100,6 +115,27 @@ save: function [
         header: body-of header
     ]
 
+    ; With no header to compute from the data, a file can be streamed from
+    ; MOLD/SINK as it goes instead of building the whole text in memory.
+    ;
+    all [
+        file? where
+        not header
+    ] then [
+        port: open/new/write where
+        trap [
+            either all_SAVE [mold/all/only/sink :value port] [
+                mold/only/sink :value port
+            ]
+            write port #{0A}  ; MOLD does not append a newline
+        ] then (lambda e [
+            close port  ; don't leave the file open if the mold failed
+            fail e
+        ])
+        close port
+        return where
+    ]
+
     ; !!! Maybe /all should be the default?  See #2159
     data: either all_SAVE [mold/all/only :value] [
         mold/only :value
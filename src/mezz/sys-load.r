@@ -260,6 +260,8 @@ load: function [
     /all "Load all values (cannot be used with /HEADER)"
     /type "E.g. rebol, text, markup, jpeg... (by default, auto-detected)"
         [word!]
+    /parallel "Scan large data in pieces split at top-level line breaks"
+    /binary "Data is in the compact format written by SAVE/BINARY"
     <in> no-all  ; !!! temporary fake of <unbind> option
 ][
     self: binding of 'return  ; so you can say SELF/ALL
@@ -281,6 +283,11 @@ load: function [
         fail "Cannot use /ALL and /HEADER refinements together"
     ]
 
+    if binary [
+        if header [fail "LOAD/BINARY data has no header"]
+        type: default ['rebol]  ; don't pick a codec from the file suffix
+    ]
+
     if block? source [
         ; A BLOCK! means multiple sources, calls LOAD recursively for each
 
@@ -291,6 +298,8 @@ load: function [
                 header: header
                 all: a
                 type: :type
+                parallel: parallel
+                binary: binary
             ]
         ]
     ]
@@ -349,9 +358,13 @@ load: function [
         return data  ; !!! Things break if you don't pass through; review
     ]
 
+    if binary [  ; values are decoded directly, no header or scanning
+        data: deserialize ensure binary! data
+    ]
+
     ; Try to load the header, handle error
 
-    if not self/all [
+    if not any [self/all binary] [
         set [hdr: data: line:] either object? data [
             fail "Code has not been updated for LOAD-EXT-MODULE"
             load-ext-module data
@@ -369,7 +382,13 @@ load: function [
 
     if not block? data [
         assert [match [binary! text!] data]  ; UTF-8
-        end: transcode/file/line (lit data:) data (opt file) 'line
+        ; /PARALLEL asks for a piece per megabyte or so (the most pieces
+        ; TRANSCODE will use is capped, and small sources aren't split).
+        ;
+        pieces: if parallel [1 + to integer! (length of data) / 1048576]
+        end: transcode/file/line/pieces (lit data:) data (opt file) 'line (
+            opt pieces
+        )
         assert [empty? end]  ; should have gone to completion
     ]
 
@@ -201,6 +201,7 @@
 
 %network/dns.test.reb
 %network/http.test.reb
+%network/tcp.test.reb
 
 %redbol/redbol-apply.test.reb
 
@@ -251,6 +252,7 @@
 %string/compress.test.reb
 %string/decode.test.reb
 %string/encode.test.reb
+%string/enbase.test.reb
 %string/decompress.test.reb
 %string/dehex.test.reb
 %string/utf8.test.reb
@@ -0,0 +1,42 @@
+REBOL [
+    Title: {Cost of COPY vs. COPY/SHARE of large blocks}
+    Description: {
+        COPY/SHARE makes the copy borrow the data of the original, and only
+        duplicates it when one of them is modified (see Share_Series_Data()
+        in %m-series.c).  So handing a large block to code that only reads
+        it costs a series node instead of a copy of every cell.
+
+        This copies a block of a million values many times each way, and
+        reports the time and the memory the copies use.  The last line
+        writes to each shared copy, to show that this cost is then paid.
+    }
+]
+
+count: 1000000
+copies: 20
+
+data: make block! count
+repeat i count [append data i]
+
+time-copies: func [
+    label [text!]
+    copier [action!]
+    /touch
+    <local> kept before time
+][
+    recycle
+    before: stats
+    kept: make block! copies
+    time: delta-time [
+        loop copies [
+            append/only kept copier data
+            if touch [append last kept 'x]
+        ]
+    ]
+    print [label time to integer! (stats - before) / 1048576 "MB"]
+    assert [(first last kept) = 1]
+]
+
+time-copies "copy:" :copy
+time-copies "copy/share:" specialize 'copy [share: true]
+time-copies/touch "copy/share + write:" specialize 'copy [share: true]
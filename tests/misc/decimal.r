@@ -0,0 +1,45 @@
+REBOL [
+    Title: {Throughput of DECIMAL! MOLD and LOAD}
+    Description: {
+        MOLD of a decimal uses Fast_Dtoa() (Grisu3) and scanning one uses
+        Fast_Strtod() (Eisel-Lemire), from %f-float.c.  Both fall back on the
+        slower dtoa() and strtod() for the values they can't prove correct.
+
+        This molds and loads blocks of decimals of a few typical shapes, and
+        reports conversions per second.  Comparing against a build with the
+        fast paths stubbed out to return 0/false shows what they save.
+    }
+]
+
+count: 1000000
+
+random/seed 1020
+
+shapes: reduce [
+    "prices" func [] [(random 1000000) / 100]
+    "ratios" func [] [(random 1000000) / 7]
+    "random bits" func [<local> bin] [
+        until [
+            bin: to binary! random 9223372036854775807
+            not ((bin/1 = 127) and [bin/2 >= 240])  ; infinity or NaN
+        ]
+        to decimal! bin
+    ]
+]
+
+rate: func [code [block!] <local> secs] [
+    secs: to decimal! delta-time code
+    to integer! count / (max secs 0.001)
+]
+
+for-each [name generator] shapes [
+    data: make block! count
+    loop count [append data generator]
+    text: mold/only data
+
+    assert [data = load text]
+
+    print [name]
+    print ["    mold:" rate [mold/only data] "per second"]
+    print ["    load:" rate [load text] "per second"]
+]
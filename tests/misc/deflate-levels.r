@@ -0,0 +1,64 @@
+REBOL [
+    Title: {Time GZIP at each level, strategy, block size and thread count}
+    Description: {
+        DEFLATE (and so GZIP) takes /LEVEL and /STRATEGY to trade ratio for
+        speed, and /BLOCKS to compress independent pieces the way pigz does.
+        This reports the time and compressed size of each on the same data,
+        a mix of text and more random bytes.
+
+        The blocks are compressed on up to TASK-THREADS threads.  The last
+        section limits that from 1 up to the number of processors, so the
+        time with one thread shows what splitting costs by itself, and the
+        others show how it scales.
+    }
+]
+
+size: 16 * 1024 * 1024
+
+data: make binary! size
+text: to binary! read %../core-tests.r
+while [(length of data) < size] [
+    append data text
+    repeat i 4096 [append data to integer! (random 256) - 1]
+]
+clear skip data size
+
+pad: func [value width] [
+    value: form value
+    head insert/dup tail value space max 0 width - length of value
+]
+
+report: func [label [text!] code [block!] <local> result time] [
+    time: delta-time [result: do code]
+    print [
+        pad label 24
+        pad mold time 16
+        pad (length of result) 10
+        "(" to integer! 100 * (length of result) / size "%)"
+    ]
+    assert [data = gunzip result]
+]
+
+print ["Compressing" size "bytes"]
+
+report "default" [gzip data]
+for-each level [0 1 3 6 9] [
+    report unspaced ["/level " level] [gzip/level data level]
+]
+for-each strategy [filtered huffman-only rle fixed] [
+    report unspaced ["/strategy " strategy] [gzip/strategy data strategy]
+]
+for-each kb [64 128 512 2048] [
+    report unspaced ["/blocks " kb "K"] [gzip/blocks data kb * 1024]
+]
+
+cpus: task-threads
+print ["Compressing with /blocks 128K on 1 to" cpus "threads"]
+
+threads: 1
+while [threads <= cpus] [
+    task-threads/limit threads
+    report unspaced ["threads " threads] [gzip/blocks data 128 * 1024]
+    threads: either threads = cpus [cpus + 1] [min cpus threads * 2]
+]
+task-threads/limit cpus
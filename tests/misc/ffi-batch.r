@@ -0,0 +1,72 @@
+REBOL [
+    Title: {Timing of FFI Routine Calls: Plain, Variadic, and ROUTINE-BATCH}
+    Description: {
+        Calls into small C functions are dominated by the cost of getting
+        the arguments from Rebol to C, not by the C code itself.  This times
+        a fixed-arity routine called from a Rebol loop against the same calls
+        made through ROUTINE-BATCH (which skips building a frame per call),
+        and a variadic routine whose call shape repeats (so its CIF can come
+        from the per-routine cache instead of ffi_prep_cif_var() each time).
+    }
+]
+
+libc: switch fourth system/version [
+    3 [make library! %msvcrt.dll]
+    4 [make library! %libc.so.6]
+]
+
+labs: make-routine libc "labs" [
+    n [int64]
+    return: [int64]
+]
+
+snprintf: make-routine libc "snprintf" [
+    buf [pointer]
+    size [int64]
+    fmt [pointer]
+    ...
+    return: [int32]
+]
+
+n: 100000
+
+data: copy []
+repeat i n [append data negate i]
+
+assert [[1 2 3] = routine-batch :labs [-1 -2 3]]
+assert [[4 5] = routine-batch :labs [[-4] [5]]]
+
+; A bad argument is reported with the number of the call it was given for.
+;
+e: trap [routine-batch :labs [-1 "two" 3]]
+assert [all [e/id = 'bad-batch-call  e/arg1 = 2]]
+
+loop-time: delta-time [
+    for-each x data [labs x]
+]
+
+batch-time: delta-time [
+    results: routine-batch :labs data
+]
+
+assert [n = length of results]
+assert [n = last results]
+
+; TEXT! and BINARY! can't be passed as pointers at the moment, so the
+; buffers are struct arrays passed by their address.
+;
+buf: make struct! [data [uint8 [64]]]
+fmt: make struct! [data [uint8 [6]]]
+fmt/data: append (to block! as binary! "%d %f") 0
+buf-addr: addr-of buf
+fmt-addr: addr-of fmt
+
+variadic-time: delta-time [
+    repeat i n [snprintf buf-addr 64 fmt-addr i [int32] 1.5 [double]]
+]
+
+print ["Calls:" n]
+print ["LABS from a loop:" loop-time]
+print ["LABS via ROUTINE-BATCH:" batch-time]
+print ["Improvement:" unspaced [round/to (loop-time / batch-time) 0.1 "x"]]
+print ["Variadic SNPRINTF (cached CIF):" variadic-time]
@@ -0,0 +1,69 @@
+REBOL [
+    Title: {Time READ of large chunked HTTP responses over loopback}
+    Description: {
+        %prot-http.r decodes chunked transfer encoding with DECODE-CHUNKED
+        from the network extension.  It takes all that has arrived on each
+        READ--even part of a chunk--so the cost is linear in the body size
+        whatever the chunk sizes are.
+
+        This serves a body in chunks of a few sizes from a server in the
+        same process, and reports how long the READs take.
+    }
+]
+
+body-size: 8 * 1024 * 1024
+reads: 5
+
+body: make binary! body-size
+repeat i body-size [append body to integer! i // 251]
+
+make-response: func [chunk-size <local> response pos chunk] [
+    response: copy ["HTTP/1.1 200 OK^M^/Transfer-Encoding: chunked^M^/^M^/"]
+    pos: body
+    while [not tail? pos] [
+        chunk: copy/part pos chunk-size
+        append response unspaced [
+            enbase/base to binary! length of chunk 16 "^M^/"
+        ]
+        append response chunk
+        append response "^M^/"
+        pos: skip pos chunk-size
+    ]
+    append response "0^M^/^M^/"
+]
+
+response: _
+
+server: open tcp://:8770
+server/awake: func [event <local> conn] [
+    if event/type = 'accept [
+        conn: first event/port
+        conn/awake: func [event] [
+            switch event/type [
+                'read [
+                    if find event/port/data #{0D0A0D0A} [
+                        write event/port response
+                    ] else [
+                        read event/port
+                    ]
+                ]
+                'wrote [close event/port]
+            ]
+            false
+        ]
+        read conn
+    ]
+    false
+]
+
+for-each chunk-size [256 4096 65536 1048576] [
+    response: make-response chunk-size
+    time: delta-time [
+        loop reads [
+            assert [body = read http://127.0.0.1:8770/]
+        ]
+    ]
+    print ["chunk size" chunk-size ":" time "for" reads "reads"]
+]
+
+close server
@@ -0,0 +1,76 @@
+REBOL [
+    Title: {Timing of Symbol Interning and Binding}
+    Description: {
+        Interning goes through one global table of canon symbols, which has
+        to be rehashed as it grows.  Binding keeps a table from canon symbol
+        to context index for the duration of each bind, which is a side
+        table owned by each binder instead of being written into the canons.
+
+        This times interning many new spellings (and looking existing ones
+        up again, with differently cased synonyms), and then the bind-heavy
+        operations of making objects and functions of various widths.
+
+        The last section is a stress test of the table being used by many
+        threads at once.  TEST-INTERNING has every one of TASK-THREADS
+        threads intern the same spellings (new ones, so the table grows
+        while they run, mixed with ones already there), and fails if any two
+        threads got different words.  Each thread does the whole list, so
+        times that stay flat as threads are added mean it scales.
+    }
+]
+
+count: 200000
+
+spellings: collect [
+    repeat i count [keep unspaced ["sym-" i "-" (i * 7919) // 10007]]
+]
+
+print ["Interning" count "new spellings:" delta-time [
+    for-each s spellings [to word! s]
+]]
+
+print ["Looking up" count "existing spellings:" delta-time [
+    for-each s spellings [to word! s]
+]]
+
+print ["Interning" count "uppercase synonyms:" delta-time [
+    for-each s spellings [to word! uppercase s]
+]]
+
+for-each width [4 32 256 4096] [
+    spec: collect [
+        repeat i width [keep reduce [to set-word! pick spellings i i]]
+    ]
+    body: collect [
+        repeat i width [keep to word! pick spellings i]
+    ]
+    times: to integer! 400000 / width
+
+    print ["MAKE OBJECT! of" width "fields, x" times ":" delta-time [
+        loop times [make object! spec]
+    ]]
+    obj: make object! spec
+    print ["BIND of" width "word body, x" times ":" delta-time [
+        loop times [bind body obj]
+    ]]
+]
+
+cpus: task-threads
+print ["Interning on 1 to" cpus "threads at once"]
+
+threads: 1
+while [threads <= cpus] [
+    task-threads/limit threads
+    batch: collect [
+        repeat i count [
+            keep unspaced ["mt-" threads "-" i]
+            keep either even? i [uppercase pick spellings i] [pick spellings i]
+        ]
+    ]
+    print [
+        threads "threads, each interning" length of batch "spellings:"
+        delta-time [test-interning batch]
+    ]
+    threads: either threads = cpus [cpus + 1] [min cpus threads * 2]
+]
+task-threads/limit cpus
@@ -0,0 +1,29 @@
+REBOL [
+    Title: {Time DECODE-JPEG at full size and with /SCALE}
+    Description: {
+        On x86-64 the IDCT uses SSE4.1 (if CPUID reports it) and the color
+        conversion and upsampling use SSE2, giving the same pixels as the C
+        code.  /SCALE reduces in the IDCT, so a thumbnail costs little more
+        than the entropy decoding.  Run this with builds from before and
+        after to compare, passing a large JPEG as the argument (the default
+        is the small logo from the test fixtures).
+    }
+]
+
+file: either system/script/args [to file! system/script/args] [
+    %../fixtures/rebol-logo.jpg
+]
+data: read file
+
+times: func [label [text!] n [integer!] code [block!]] [
+    print [label "x" n ":" delta-time [loop n code]]
+]
+
+print ["Full size is" (decode-jpeg data)/size]
+times "decode-jpeg" 20 [decode-jpeg data]
+for-each scale [2 4 8] [
+    print ["1 /" scale "size is" (decode-jpeg/scale data scale)/size]
+    times unspaced ["decode-jpeg/scale " scale] 20 [
+        decode-jpeg/scale data scale
+    ]
+]
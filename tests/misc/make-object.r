@@ -0,0 +1,44 @@
+REBOL [
+    Title: {Allocations and Timing of MAKE OBJECT! From a Template}
+    Description: {
+        MAKE OBJECT! used to collect the keys of its body into a new keylist
+        each time, then bind the body deeply and evaluate it.  Objects made
+        from the same body now share one memoized keylist, and bodies that
+        are only SET-WORD!s with inert literal values are copied straight
+        into the new object without binding or evaluating.
+
+        This makes many records from a literal template, from a template
+        with expressions (which still evaluates, but reuses the keylist), and
+        derived from a parent (which doesn't use the memoization).  Series
+        allocation counts are only available in debug builds (STATS/PROFILE)
+        so they are left out in release builds.
+    }
+]
+
+count: 100000
+
+series-made: func [<local> p] [
+    either trap [p: stats/profile] [_] [p/series-made]
+]
+
+measure: func [label [text!] code [block!] <local> made time] [
+    made: series-made
+    time: delta-time code
+    print [
+        label ":" time
+        if made [unspaced ["(" (series-made - made) " series)"]]
+    ]
+]
+
+measure "literal template" [
+    loop count [make object! [name: "" age: 0 id: #none score: 1.5]]
+]
+
+measure "evaluated template" [
+    loop count [make object! [name: copy "" age: 1 + 2 id: _ score: 1.5]]
+]
+
+parent: make object! [name: "" age: 0 id: _ score: 1.5]
+measure "derived from parent" [
+    loop count [make parent [age: 10]]
+]
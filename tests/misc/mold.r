@@ -0,0 +1,51 @@
+REBOL [
+    Title: {Throughput of MOLD to a File, Whole vs. Streamed}
+    Description: {
+        SAVE used to MOLD the whole value into the mold buffer, copy that out
+        as a TEXT!, convert it to a BINARY!, and then WRITE it.  Saving to a
+        file now uses MOLD/SINK, which writes the mold buffer out to the port
+        each time 64K has built up (at a value boundary) and then reuses it.
+
+        This times writing a large nested block both ways (reported in MB/s
+        of UTF-8 written), along with the growth in memory use while it runs.
+    }
+]
+
+rows: 200000
+count: 3
+
+data: make block! rows
+repeat i rows [
+    append/only data reduce [
+        i "some text" 'word 1.5 [nested [block 10x20]] #{DECAFBAD}
+    ]
+]
+
+file: %mold-bench.r
+size: length of to binary! mold/only data
+
+rate: func [code [block!] <local> secs] [
+    secs: to decimal! delta-time [loop count code]
+    round/to (count * size) / 1048576 / (max secs 0.001) 0.1
+]
+
+growth: func [code [block!] <local> before] [
+    recycle
+    before: stats
+    do code
+    round/to ((stats) - before) / 1048576 0.1
+]
+
+whole: [write file to binary! mold/only data]
+streamed: [
+    port: open/new/write file
+    mold/only/sink data port
+    close port
+]
+
+print ["size:" round/to size / 1048576 0.1 "MB"]
+print ["whole:" rate whole "MB/s," growth whole "MB growth"]
+print ["streamed:" rate streamed "MB/s," growth streamed "MB growth"]
+
+assert [(read file) = to binary! mold/only data]
+delete file
@@ -0,0 +1,32 @@
+REBOL [
+    Title: {Timing of Object Field Access by Object Width}
+    Description: {
+        Field lookups in objects used to be a linear scan of the keylist, so
+        access to the last field of a wide object (e.g. a config record or
+        decoded JSON-like data) took time proportional to the width.  Wide
+        keylists now get a hash table on first lookup, shared by all objects
+        which share the keylist.
+
+        This times path access and SELECT of the first and last fields of
+        objects of increasing width.  Times should be flat as width grows.
+    }
+]
+
+count: 200000
+
+for-each width [4 16 64 256 1024] [
+    spec: collect [
+        repeat i width [keep reduce [to set-word! join "field" i i]]
+    ]
+    obj: make object! spec
+    derived: make obj []  ; shares the keylist (and its lookup table)
+    last-field: to word! join "field" width
+
+    print [width "fields:"]
+    print ["    obj/field1" delta-time [loop count [obj/field1]]]
+    print ["    obj/(last)" delta-time [loop count [obj/(last-field)]]]
+    print ["    derived/(last)" delta-time [
+        loop count [derived/(last-field)]
+    ]]
+    print ["    select" delta-time [loop count [select obj last-field]]]
+]
@@ -0,0 +1,76 @@
+REBOL [
+    Title: {Time DECODE-PNG and ENCODE-PNG's modes on a large screenshot}
+    Description: {
+        8-bit PNGs that aren't interlaced decode a row at a time, right into
+        the image (or an existing one with /INTO).  For encoding, this shows
+        the time and size of the default (per-row MINSUM filter choice),
+        each single filter, /FAST and /BANDS.
+
+        The bands are deflated on up to TASK-THREADS threads.  The last
+        section limits that from 1 up to the number of processors, so the
+        time with one thread shows what splitting costs by itself, and the
+        others show how it scales.
+
+        Pass a PNG screenshot as the argument.  The default is a 2560x1440
+        image of the logo from the test fixtures tiled on white.
+    }
+]
+
+either system/script/args [
+    data: read to file! system/script/args
+    img: decode-png data
+][
+    logo: decode-png read %../fixtures/rebol-logo.png
+    img: make image! reduce [2560x1440 255.255.255]
+    y: 0
+    while [y < 1440] [
+        x: 0
+        while [x < 2560] [
+            composite-image/at img logo make pair! reduce [x y]
+            x: x + logo/size/x + 23
+        ]
+        y: y + logo/size/y + 17
+    ]
+    data: encode-png img
+]
+
+times: func [label [text!] n [integer!] code [block!]] [
+    print [label "x" n ":" delta-time [loop n code]]
+]
+
+target: make image! img/size
+
+print ["Image is" img/size "," length of data "bytes as PNG"]
+times "decode-png" 10 [decode-png data]
+times "decode-png/into" 10 [decode-png/into data target]
+
+report: func [label [text!] code [block!] <local> result time] [
+    time: delta-time [result: do code]
+    print [label ":" time "," length of result "bytes"]
+    assert [img = decode-png result]
+]
+
+report "encode-png" [encode-png img]
+for-each filter [none sub up average paeth] [
+    report unspaced ["encode-png/filter " filter] [
+        encode-png/filter img filter
+    ]
+]
+report "encode-png/fast" [encode-png/fast img]
+for-each rows [16 64 256] [
+    report unspaced ["encode-png/bands " rows] [encode-png/bands img rows]
+    report unspaced ["encode-png/fast/bands " rows] [
+        encode-png/fast/bands img rows
+    ]
+]
+
+cpus: task-threads
+print ["ENCODE-PNG/BANDS 64 on 1 to" cpus "threads"]
+
+threads: 1
+while [threads <= cpus] [
+    task-threads/limit threads
+    report unspaced ["threads " threads] [encode-png/bands img 64]
+    threads: either threads = cpus [cpus + 1] [min cpus threads * 2]
+]
+task-threads/limit cpus
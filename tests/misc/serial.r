@@ -0,0 +1,45 @@
+REBOL [
+    Title: {Throughput of SAVE/BINARY and LOAD/BINARY vs. MOLD and LOAD}
+    Description: {
+        Data saved as MOLD text has to go through the whole scanner again on
+        LOAD: delimiters, number parsing (decimals through %f-dtoa.c), string
+        escapes, and interning each word at every occurrence.  SAVE/BINARY
+        writes values with length prefixes, integers and decimals as raw
+        numbers, and a symbol table so each spelling is interned once.
+
+        This saves and loads a large nested block both ways (reporting MB/s
+        of the text form, so the rates are comparable) and the saved sizes.
+    }
+]
+
+rows: 100000
+count: 3
+
+data: make block! rows
+repeat i rows [
+    append/only data reduce [
+        i i * 1.25 "some text" 'word 'other-word [nested [block of words]]
+        #{DECAFBAD} 12.5%
+    ]
+]
+
+size: length of to binary! mold/only data
+
+rate: func [code [block!] <local> secs] [
+    secs: to decimal! delta-time [loop count code]
+    round/to (count * size) / 1048576 / (max secs 0.001) 0.1
+]
+
+text: to binary! mold/only data
+bin: save/binary _ data
+
+assert [data = load text]
+assert [data = load/binary bin]
+
+print ["text size:" round/to size / 1048576 0.1 "MB"]
+print ["binary size:" round/to (length of bin) / 1048576 0.1 "MB"]
+
+print ["mold:" rate [to binary! mold/only data] "MB/s"]
+print ["save/binary:" rate [save/binary _ data] "MB/s"]
+print ["load:" rate [load text] "MB/s"]
+print ["load/binary:" rate [load/binary bin] "MB/s"]
@@ -0,0 +1,60 @@
+REBOL [
+    Title: {Timing of TCC Compilation With and Without the Object Cache}
+    Description: {
+        Programs which define many user natives compile all of them each time
+        they start up.  COMPILE's CACHE-DIR setting keeps the object code on
+        disk, so that later runs only have to load and link it.
+
+        This defines a batch of user natives, compiles it once into an empty
+        cache directory (a "first run") and then again from the cache (what
+        every later startup would see).  The natives are re-made between the
+        two compiles, just as they would be in a fresh interpreter session.
+    }
+]
+
+count: 50
+
+cache-dir: join what-dir %tcc-cache-test/
+if exists? cache-dir [
+    for-each file read cache-dir [delete join cache-dir file]
+]
+
+make-natives: function [
+    {Make COUNT user natives whose C source is identical from run to run}
+    return: [block!]
+][
+    collect [
+        repeat i count [
+            keep make-native [
+                "Sum integers from 1 up to N, plus a per-native constant"
+                n [integer!]
+            ] unspaced [{
+                int n = rebUnboxInteger(rebArgR("n"));
+                int sum = } i {;
+                int j;
+                for (j = 1; j <= n; ++j) { sum += j; }
+                return rebInteger(sum);
+            }]
+        ]
+    ]
+]
+
+settings: compose [cache-dir (cache-dir)]
+
+natives: make-natives
+first-run: delta-time [compile/settings natives settings]
+
+natives: make-natives
+cached-run: delta-time [compile/settings natives settings]
+
+; Both runs have to produce working natives
+;
+first-native: first natives
+last-native: last natives
+assert [(1 + 5050) = first-native 100]
+assert [(count + 5050) = last-native 100]
+
+print ["Natives:" count]
+print ["First run (compile + cache):" first-run]
+print ["Cached run (load + link):" cached-run]
+print ["Speedup:" unspaced [round/to (first-run / cached-run) 0.1 "x"]]
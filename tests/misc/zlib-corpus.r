@@ -0,0 +1,45 @@
+REBOL [
+    Title: {Time the zlib checksums, INFLATE and DEFLATE on a mixed corpus}
+    Description: {
+        The zlib in %u-zlib.c has fast paths for CRC-32 and Adler-32 (on
+        x86-64 CPUs with PCLMULQDQ and SSSE3), and for match finding and
+        match copying.  Run this with builds from before and after them to
+        compare; the compressed sizes and checksums should be the same.
+
+        The corpus is source text, bytes that won't compress, long runs of
+        one byte, and image-like rows (as PNG would see them).
+    }
+]
+
+corpus: make binary! 16 * 1024 * 1024
+
+for-each file [%../core-tests.r %../../src/mezz/base-funcs.r] [
+    append corpus read file
+]
+while [(length of corpus) < (8 * 1024 * 1024)] [
+    append corpus copy/part corpus 1024 * 1024
+]
+repeat i 2 * 1024 * 1024 [append corpus to integer! (random 256) - 1]
+append/dup corpus #{07} 1024 * 1024
+repeat y 1000 [
+    repeat x 3000 [append corpus to integer! (x * 3 + y) // 256]
+]
+
+times: func [label [text!] n [integer!] code [block!]] [
+    print [label "x" n ":" delta-time [loop n code]]
+]
+
+print ["Corpus is" length of corpus "bytes"]
+
+print ["CRC-32:" checksum-core corpus 'crc32]
+print ["Adler-32:" checksum-core corpus 'adler32]
+times "checksum-core 'crc32" 10 [checksum-core corpus 'crc32]
+times "checksum-core 'adler32" 10 [checksum-core corpus 'adler32]
+
+for-each level [1 6 9] [
+    compressed: zdeflate/level corpus level
+    print ["Level" level "size:" length of compressed]
+    times unspaced ["zdeflate/level " level] 1 [zdeflate/level corpus level]
+    times unspaced ["zinflate (level " level ")"] 5 [zinflate compressed]
+    assert [corpus = zinflate compressed]
+]
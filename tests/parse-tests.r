@@ -179,6 +179,47 @@
     (not parse "ba" compose [to (charset "a") "ba" end])
 ]
 
+; repeated charset rules skip whole runs of matching input at once
+
+(
+    alpha: charset [#"a" - #"z"]
+    did all [
+        parse "abc123" [copy x some alpha (y: x) some "1" "23" end]
+        y = "abc"
+        parse "ABC" [some alpha end]  ; uncased by default
+        not parse/case "ABC" [some alpha end]
+        not parse "123" [some alpha to end]
+        parse "123" [any alpha "123" end]
+        parse "abcd" [2 3 alpha "d" end]
+        not parse "abcd" [2 3 alpha end]
+        not parse "a" [2 alpha end]
+    ]
+)
+(
+    wide: charset [#"a" #"é" #"^(4E2D)"]
+    did all [
+        parse "aéa中é" [some wide end]
+        parse "aéa中éb" [copy x some wide "b" end]
+        x = "aéa中é"
+        parse "ÉA" [some wide end]
+        not parse/case "ÉA" [some wide end]
+    ]
+)
+(
+    not-digit: complement charset "0123456789"
+    did parse "ab-é1" [some not-digit "1" end]
+)
+(
+    alpha: charset [#"a" - #"z"]
+    did all [
+        parse #{616263313233} [some alpha #{313233} end]
+        parse #{4142} [some alpha end]
+        not parse/case #{4142} [some alpha end]
+        high: charset [254 - 255]
+        parse #{FFFE61} [some high #{61} end]
+    ]
+)
+
 ; self-modifying rule, not legal in Ren-C if it's during the parse
 
 (error? trap [
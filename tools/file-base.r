@@ -45,6 +45,7 @@ core: [
     c-port.c
     c-signal.c
     c-specialize.c
+    c-thread.c
     c-value.c
     c-word.c
 
@@ -103,6 +104,7 @@ core: [
         <msc:/wd5045>  ; https://stackoverflow.com/q/50399940
     ]
     f-extension.c
+    f-float.c
     f-int.c
     f-math.c
     f-modify.c
@@ -144,6 +146,7 @@ core: [
     s-make.c
     s-mold.c
     s-ops.c
+    s-serial.c
 
     ; (T)ypes
     t-binary.c
@@ -449,6 +449,16 @@ e-lib/emit {
      */
     typedef REBVAL* (REBRSC)(REBVAL *error, void *opaque);
 
+    /*
+     * "Sink Function" called by rebMoldSink() with each chunk of UTF-8 as it
+     * is molded.  The bytes are not terminated, and only valid for the call.
+     */
+    typedef void (REBSNK)(
+        const unsigned char *utf8,
+        size_t size,
+        void *opaque
+    );
+
     /*
      * For some HANDLE!s GC callback
      */
@@ -31,6 +31,11 @@ REBOL [
         rid of them:
 
         https://stackoverflow.com/a/30809775
+
+        !!! %u-zlib.c also has by-hand "REBOL: fast path" sections (hardware
+        CRC-32 and Adler-32 on x86-64, word-at-a-time longest_match() and
+        wider copies in inflate_fast()).  A new import loses them unless
+        they are carried over; the explanation is at the top of the file.
     ]
 ]
 
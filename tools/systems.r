@@ -75,13 +75,13 @@ systems: [
         ; was: "Macintosh, FAT PPC, 68K"
 
     0.2.04 osx-ppc/osx "osx-ppc"
-        #SGD #BEN #LLC #F64 <NCM> /HID /DYN %M ; originally targeted OS X 10.2
+        #SGD #BEN #LLC #F64 <NCM> /HID /DYN %M %PTH ; originally targeted OS X 10.2
 
     0.2.05 osx-x86/osx "osx-x86"
-        #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> <ARC> /HID /ARC /DYN %M
+        #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> <ARC> /HID /ARC /DYN %M %PTH
 
     0.2.40 osx-x64/osx _
-        #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> /HID /DYN %M
+        #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> /HID /DYN %M %PTH
 
     Windows: 3
     ;-------------------------------------------------------------------------
@@ -101,13 +101,13 @@ systems: [
         ; was: "Linux Libc5 iX86 1.2.1.4.1 view-pro041.tar.gz"
 
     0.4.02 linux-x86/linux "libc6-2-3-x86"
-        #SGD #LEN #LLC #NSER #F64 <M32> <NSP> <UFS> /M32 %M %DL ;gliblc-2.3
+        #SGD #LEN #LLC #NSER #F64 <M32> <NSP> <UFS> /M32 %M %DL %PTH ;gliblc-2.3
 
     0.4.03 linux-x86/linux "libc6-2-5-x86"
-        #SGD #LEN #LLC #F64 <M32> <UFS> /M32 %M %DL ;gliblc-2.5
+        #SGD #LEN #LLC #F64 <M32> <UFS> /M32 %M %DL %PTH ;gliblc-2.5
 
     0.4.04 linux-x86/linux "libc6-2-11-x86"
-        #SGD #LEN #LLC #F64 #PIP2 <M32> <HID> /M32 /HID /DYN %M %DL ;glibc-2.11
+        #SGD #LEN #LLC #F64 #PIP2 <M32> <HID> /M32 /HID /DYN %M %DL %PTH ;glibc-2.11
 
     0.4.05 _ _
         ; was: "Linux 68K"
@@ -125,34 +125,34 @@ systems: [
         ; was: "Linux Cobalt Qube MIPS"
 
     0.4.10 linux-ppc/linux "libc6-ppc"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.11 linux-ppc64/linux "libc6-ppc64"
-        #SGD #BEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.20 linux-arm/linux "libc6-arm"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.21 linux-arm/linux _
         #SGD #LEN #LLC #F64 #PIP2 <HID> <PIE> /HID /DYN %M %DL ;android
 
     0.4.22 linux-aarch64/linux "libc6-aarch64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.30 linux-mips/linux "libc6-mips"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.31 linux-mips32be/linux "libc6-mips32be"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.40 linux-x64/linux "libc-x64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.60 linux-axp/linux "dec-alpha"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.61 linux-ia64/linux "libc-ia64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     BeOS: 5
     ;-------------------------------------------------------------------------
@@ -176,10 +176,10 @@ systems: [
         ; was: "Free BSD iX86"
 
     0.7.02 freebsd-x86/posix "elf-x86"
-        #SGD #LEN #LLC #F64 %M
+        #SGD #LEN #LLC #F64 %M %PTH
 
     0.7.40 freebsd-x64/posix _
-        #SGD #LEN #LLC #F64 #LP64 %M
+        #SGD #LEN #LLC #F64 #LP64 %M %PTH
 
     NetBSD: 8
     ;-------------------------------------------------------------------------
@@ -210,13 +210,13 @@ systems: [
         ; was: "OpenBSD 68K"
 
     0.9.04 openbsd-x86/posix "elf-x86"
-        #SGD #LEN #LLC #F64 %M
+        #SGD #LEN #LLC #F64 %M %PTH
 
     0.9.05 _ "sparc"
         ; was: "OpenBSD Sparc"
 
     0.9.40 openbsd-x64/posix "elf-x64"
-        #SGD #LEN #LLC #F64 #LP64 %M
+        #SGD #LEN #LLC #F64 #LP64 %M %PTH
 
     Sun: 10
     ;-------------------------------------------------------------------------
@@ -247,10 +247,10 @@ systems: [
     Syllable: 14
     ;-------------------------------------------------------------------------
     0.14.01 syllable-dtp/posix _
-        #SGD #LEN #LLC #F64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 <HID> /HID /DYN %M %DL %PTH
 
     0.14.02 syllable-svr/linux _
-        #SGD #LEN #LLC #F64 <M32> <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 <M32> <HID> /HID /DYN %M %DL %PTH
 
     WindowsCE: 15
     ;-------------------------------------------------------------------------
@@ -411,6 +411,7 @@ system-libraries: make object! [
     M: <gnu:m>
 
     DL: "dl" ; dynamic lib
+    PTH: "pthread" ; worker threads of Run_Tasks(), see %c-thread.c
     LOG: "log" ; Link with liblog.so on Android
     
     W32: ["wsock32" "comdlg32" "user32" "shell32" "advapi32"]